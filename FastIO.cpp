@@ -55,11 +55,23 @@ fio_register fio_pinToOutputRegister(uint8_t pin, uint8_t initial_state)
 	//  just wasting memory if not using fast io...
 	return 0;
 #else
-	return portOutputRegister(digitalPinToPort(pin));
+	return FIO_OUTPUT_REGISTER(pin);
 #endif
 }
 
 
+uint8_t fio_atomic = FIO_ATOMIC;
+
+void fio_setAtomic(uint8_t atomic)
+{
+	fio_atomic = atomic;
+}
+
+uint8_t fio_getAtomic(void)
+{
+	return fio_atomic;
+}
+
 fio_register fio_pinToInputRegister(uint8_t pin)
 {
 	pinMode(pin, INPUT);
@@ -68,7 +80,7 @@ fio_register fio_pinToInputRegister(uint8_t pin)
 	//  just wasting memory if not using fast io...
 	return 0;
 #else
-	return portInputRegister(digitalPinToPort(pin));
+	return FIO_INPUT_REGISTER(pin);
 #endif
 }
 
@@ -79,7 +91,7 @@ fio_bit fio_pinToBit(uint8_t pin)
 	// (ab)use the bit variable to store the pin
 	return pin;
 #else
-	return digitalPinToBitMask(pin);
+	return FIO_PIN_BIT(pin);
 #endif
 }
 
@@ -103,7 +115,7 @@ void fio_digitalWrite(fio_register pinRegister, fio_bit pinBit, uint8_t value)
 #endif
 }
 
-int fio_digitalRead(fio_register pinRegister, uint8_t pinBit)
+int fio_digitalRead(fio_register pinRegister, fio_bit pinBit)
 {
 #ifdef FIO_FALLBACK
 	return digitalRead (pinBit);
@@ -116,51 +128,53 @@ int fio_digitalRead(fio_register pinRegister, uint8_t pinBit)
 #endif
 }
 
+// Shifts out one bit
+static inline void fio_shiftBit (fio_register dataRegister, fio_bit dataBit, 
+                                 fio_register clockRegister, fio_bit clockBit, 
+                                 uint8_t bit)
+{
+	if(bit)
+	{
+		fio_digitalWrite_HIGH(dataRegister, dataBit);
+	}
+	else
+	{
+		fio_digitalWrite_LOW(dataRegister, dataBit);
+	}
+	fio_digitalWrite_HIGH (clockRegister, clockBit);
+	fio_digitalWrite_LOW (clockRegister,clockBit);
+}
+
 void fio_shiftOut (fio_register dataRegister, fio_bit dataBit, 
                    fio_register clockRegister, fio_bit clockBit, 
-                   uint8_t value, uint8_t bitOrder)
+                   uint8_t value, uint8_t bitOrder, uint8_t atomic)
 {
-	// # disable interrupts
 	int8_t i;
-   
-	if(bitOrder == LSBFIRST)
+	uint8_t bitAtomic = ( atomic == FIO_ATOMIC_BIT );
+	
+	// # disable interrupts for each bit or once for the whole byte
+	FIO_CRITICAL( atomic == FIO_ATOMIC_BYTE )
 	{
-		for(i = 0; i < 8; i++)
+		if(bitOrder == LSBFIRST)
 		{
-			ATOMIC_BLOCK(ATOMIC_RESTORESTATE)
+			for(i = 0; i < 8; i++)
 			{
-				if(value & 1)
-            {
-               fio_digitalWrite_HIGH(dataRegister, dataBit);
+				FIO_CRITICAL( bitAtomic )
+				{
+					fio_shiftBit(dataRegister, dataBit, clockRegister, clockBit, value & 0x01);
 				}
-            else
-            {
-               fio_digitalWrite_LOW(dataRegister, dataBit);
-            }
-            value >>= 1;
-				fio_digitalWrite_HIGH (clockRegister, clockBit);
-				fio_digitalWrite_LOW (clockRegister,clockBit);
+				value >>= 1;
 			}
 		}
-      
-	}
-	else
-	{
-		for(i = 0; i < 8; i++)
+		else
 		{
-			ATOMIC_BLOCK(ATOMIC_RESTORESTATE)
+			for(i = 0; i < 8; i++)
 			{
-				if(value & 0x80)
-            {
-               fio_digitalWrite_HIGH(dataRegister, dataBit);
+				FIO_CRITICAL( bitAtomic )
+				{
+					fio_shiftBit(dataRegister, dataBit, clockRegister, clockBit, value & 0x80);
 				}
-            else
-            {
-               fio_digitalWrite_LOW(dataRegister, dataBit);
-            }
 				value <<= 1;
-				fio_digitalWrite_HIGH (clockRegister, clockBit);
-				fio_digitalWrite_LOW (clockRegister,clockBit);
 			}
 		}
 	}
@@ -170,7 +184,7 @@ void fio_shiftOut (fio_register dataRegister, fio_bit dataBit,
 void fio_shiftOut(fio_register dataRegister, fio_bit dataBit, 
                   fio_register clockRegister, fio_bit clockBit)
 {
-   ATOMIC_BLOCK(ATOMIC_RESTORESTATE)
+   FIO_OP_BLOCK
    {
       // shift out 0x0 (B00000000) fast, byte order is irrelevant
       fio_digitalWrite_LOW (dataRegister, dataBit);
@@ -52,6 +52,40 @@
 
 #define SKIP 0x23
 
+/*!
+ @defined
+ @abstract   Hardware SPI pin token.
+ @discussion Passed as the data (and clock) pin of the shift register drivers
+ to load the shift register through the SPI peripheral: the register data
+ input connects to MOSI and its clock to SCK.
+ */
+#define HW_SPI 205
+
+/*!
+ @defined
+ @abstract   SPI clock used to load the shift registers.
+ @discussion 8MHz is F_CPU/2 on a 16MHz AVR and well within the 74HC595
+ limits at 3.3V and 5V.
+ */
+#ifndef SR_SPI_CLOCK
+#define SR_SPI_CLOCK 8000000
+#endif
+
+/*!
+ @defined
+ @abstract   The SPI library is available to the HW_SPI drivers.
+ @discussion Set when <SPI.h> can be included, so the drivers build on cores
+ and targets without an SPI library (ATtiny with TinyWireM). Sketches using
+ HW_SPI include <SPI.h> so the IDE adds the library to the build. Define
+ FIO_NO_HW_SPI to leave the SPI code out. Without it, drivers created with
+ HW_SPI send nothing.
+ */
+#if !defined (FIO_NO_HW_SPI) && defined (__has_include)
+#if __has_include(<SPI.h>)
+#define FIO_HW_SPI
+#endif
+#endif
+
 #if defined (__AVR__)
 #include <util/atomic.h> // for critical section management
 typedef uint8_t fio_bit;
@@ -63,6 +97,46 @@ typedef uint32_t fio_bit;
 typedef volatile uint32_t *fio_register;
 // __PIC32MX__ processor end
 
+#elif defined(ARDUINO_ARCH_SAMD)
+// PORT group: OUTCLR, OUTSET and OUTTGL follow the OUT register
+typedef uint32_t fio_bit;
+typedef volatile uint32_t *fio_register;
+#define FIO_OUTCLR 1
+#define FIO_OUTSET 2
+#define FIO_OUTTGL 3
+// ARDUINO_ARCH_SAMD processor end
+
+#elif defined(ARDUINO_ARCH_ESP32)
+// GPIO: out_w1ts and out_w1tc follow the out register of both banks
+typedef uint32_t fio_bit;
+typedef volatile uint32_t *fio_register;
+#define FIO_OUTSET 1
+#define FIO_OUTCLR 2
+// ARDUINO_ARCH_ESP32 processor end
+
+#elif defined(ARDUINO_ARCH_RP2040) && !defined(ARDUINO_ARCH_MBED)
+// SIO: gpio_set, gpio_clr and gpio_togl follow gpio_out, Arduino pin numbers
+// are GPIO numbers.
+#include <hardware/structs/sio.h>
+typedef uint32_t fio_bit;
+typedef volatile uint32_t *fio_register;
+#define FIO_OUTSET 1
+#define FIO_OUTCLR 2
+#define FIO_OUTTGL 3
+#define FIO_OUTPUT_REGISTER(pin) (&sio_hw->gpio_out)
+#define FIO_INPUT_REGISTER(pin)  (&sio_hw->gpio_in)
+#define FIO_PIN_BIT(pin)         (1ul << (pin))
+// ARDUINO_ARCH_RP2040 processor end
+
+#elif defined(ARDUINO_ARCH_STM32)
+// The register used is BSRR: bits 0..15 set, bits 16..31 reset the pin. It
+// follows ODR in every STM32 family (F1 included).
+typedef uint32_t fio_bit;
+typedef volatile uint32_t *fio_register;
+#define FIO_BSRR
+#define FIO_OUTPUT_REGISTER(pin) (portOutputRegister(digitalPinToPort(pin)) + 1)
+// ARDUINO_ARCH_STM32 processor end
+
 #else
 // fallback to Arduino standard digital i/o routines
 #define FIO_FALLBACK
@@ -96,6 +170,100 @@ static __inline__ void __iSeiParam(const uint8_t *__s)
 
 #endif // end of block to create compatible ATOMIC_BLOCK()
 
+/*!
+ @defined
+ @abstract   Critical section policies of the shift routines.
+ @discussion FIO_ATOMIC_BIT: interrupts are disabled for each bit, the
+ lowest interrupt latency. FIO_ATOMIC_BYTE: interrupts are disabled once for
+ the whole byte, the fastest. FIO_ATOMIC_NONE: no critical section, for
+ callers already running in an ISR or in an RTOS critical section. Leaving a
+ critical section re-enables the interrupts on the cores without
+ save/restore support, so FIO_ATOMIC_NONE is required there.
+
+ Rough estimates only, counted from the instructions of fio_shiftOut on a
+ 16MHz AVR and not measured on hardware: a bit takes about 22 cycles plus
+ about 3 for its critical section, so about 12.5us per byte with
+ FIO_ATOMIC_BIT (interrupts held off for about 1.5us at a time) against
+ about 11us with FIO_ATOMIC_BYTE (held off for the whole byte) and
+ FIO_ATOMIC_NONE. Time it on the target when the margin matters.
+ */
+#define FIO_ATOMIC_BIT  0
+#define FIO_ATOMIC_BYTE 1
+#define FIO_ATOMIC_NONE 2
+
+/*!
+ @defined
+ @abstract   Critical section policy at start up.
+ @discussion Used by fio_shiftOut and the shift register LCD drivers until a
+ sketch calls fio_setAtomic(). Define it for the whole build to change the
+ start up policy.
+ */
+#ifndef FIO_ATOMIC
+#define FIO_ATOMIC FIO_ATOMIC_BIT
+#endif
+
+// Current critical section policy, set with fio_setAtomic()
+extern uint8_t fio_atomic;
+
+/*!
+ @defined
+ @abstract   Conditional critical section.
+ @discussion Runs the following block with the interrupts disabled when
+ enter is true, else as is. On AVR the interrupt flag is restored on the way
+ out, elsewhere the interrupts are re-enabled as by ATOMIC_BLOCK.
+ */
+#ifdef FIO_FALLBACK
+#define FIO_CRITICAL(enter) if(((void)(enter)), true)
+#else
+static __inline__ uint8_t __fioEnter(uint8_t enter)
+{
+   if(!enter)
+   {
+      return(0);
+   }
+#if defined (__AVR__)
+   uint8_t sreg = SREG;
+   cli();
+   return((sreg & (1 << SREG_I)) ? 1 : 2);
+#else
+   noInterrupts();
+   return(1);
+#endif
+}
+static __inline__ void __fioLeave(const uint8_t *state)
+{
+   if(*state == 1)
+   {
+      interrupts();
+   }
+}
+#define FIO_CRITICAL(enter) for(uint8_t __fioState \
+              __attribute__((__cleanup__(__fioLeave))) = __fioEnter(enter), \
+              __fioTodo = 1; __fioTodo; __fioTodo = 0)
+#endif
+
+/*!
+ @defined
+ @abstract   Critical sections following the current policy.
+ @discussion FIO_BIT_BLOCK wraps each bit and FIO_BYTE_BLOCK the whole byte,
+ only one of them is a critical section. FIO_OP_BLOCK wraps other short
+ sequences (latch strobes), a critical section unless FIO_ATOMIC_NONE.
+ */
+#define FIO_BIT_BLOCK  FIO_CRITICAL(fio_atomic == FIO_ATOMIC_BIT)
+#define FIO_BYTE_BLOCK FIO_CRITICAL(fio_atomic == FIO_ATOMIC_BYTE)
+#define FIO_OP_BLOCK   FIO_CRITICAL(fio_atomic != FIO_ATOMIC_NONE)
+
+// Default pin to register/bit mapping using the Arduino core port macros
+#ifndef FIO_OUTPUT_REGISTER
+#define FIO_OUTPUT_REGISTER(pin) portOutputRegister(digitalPinToPort(pin))
+#endif
+#ifndef FIO_INPUT_REGISTER
+#define FIO_INPUT_REGISTER(pin)  portInputRegister(digitalPinToPort(pin))
+#endif
+#ifndef FIO_PIN_BIT
+#define FIO_PIN_BIT(pin)         digitalPinToBitMask(pin)
+#endif
+
 /*!
  @defined 
  @abstract   Performs a bitwise shift.
@@ -110,6 +278,23 @@ static __inline__ void __iSeiParam(const uint8_t *__s)
 #define _BV(bit) (1 << (bit))
 #endif
 
+/*!
+ @function
+ @abstract  Sets the critical section policy.
+ @discussion Applies to fio_shiftOut and every shift register LCD driver
+ from their next write on. Use FIO_ATOMIC_NONE when the LCD is only driven
+ from an ISR or inside an RTOS critical section.
+ @param  atomic[in] FIO_ATOMIC_BIT, FIO_ATOMIC_BYTE or FIO_ATOMIC_NONE
+ */
+void fio_setAtomic(uint8_t atomic);
+
+/*!
+ @function
+ @abstract  Returns the critical section policy set with fio_setAtomic().
+ @result  FIO_ATOMIC_BIT, FIO_ATOMIC_BYTE or FIO_ATOMIC_NONE
+ */
+uint8_t fio_getAtomic(void);
+
 /*!
  @function
  @abstract  Get the output register for specified pin.
@@ -154,13 +339,39 @@ void fio_digitalWrite ( fio_register pinRegister, fio_bit pinBit, uint8_t value
  * This is where the magic happens that makes things fast.
  * Implemented as preprocessor directives to force inlining
  * SWITCH is fast for FIO but probably slow for FIO_FALLBACK so SWITCHTO is recommended if the value is known.
+ * PORT writes the bits of val selected by mask in one go, val is already in
+ * port bit positions. It is not available with FIO_FALLBACK.
  */
 
-#ifndef FIO_FALLBACK
+#if defined(FIO_BSRR)
+// reg -> BSRR, ODR is the register right before it
+#define fio_digitalWrite_LOW(reg,bit) *(reg) = ((fio_bit)(bit) << 16)
+#define fio_digitalWrite_HIGH(reg,bit) *(reg) = (bit)
+#define fio_digitalWrite_SWITCH(reg,bit) (reg)[-1] ^= (bit)
+// set has priority over reset, so clearing the whole mask is a single store
+#define fio_digitalWrite_PORT(reg,mask,val) \
+   *(reg) = ((fio_bit)(mask) << 16) | ((val) & (mask))
+#define fio_digitalWrite_SWITCHTO(reg,bit,val) \
+   do { if (val) fio_digitalWrite_HIGH(reg,bit); else fio_digitalWrite_LOW(reg,bit); } while (0)
+#elif defined(FIO_OUTSET)
+// reg -> output register, write one to set/clear registers are single stores
+#define fio_digitalWrite_LOW(reg,bit) (reg)[FIO_OUTCLR] = (bit)
+#define fio_digitalWrite_HIGH(reg,bit) (reg)[FIO_OUTSET] = (bit)
+#ifdef FIO_OUTTGL
+#define fio_digitalWrite_SWITCH(reg,bit) (reg)[FIO_OUTTGL] = (bit)
+#else
+#define fio_digitalWrite_SWITCH(reg,bit) *(reg) ^= (bit)
+#endif
+#define fio_digitalWrite_PORT(reg,mask,val) \
+   do { (reg)[FIO_OUTCLR] = (mask) & ~(val); (reg)[FIO_OUTSET] = (val) & (mask); } while (0)
+#define fio_digitalWrite_SWITCHTO(reg,bit,val) \
+   do { if (val) fio_digitalWrite_HIGH(reg,bit); else fio_digitalWrite_LOW(reg,bit); } while (0)
+#elif !defined(FIO_FALLBACK)
 #define fio_digitalWrite_LOW(reg,bit) *reg &= ~bit
 #define fio_digitalWrite_HIGH(reg,bit) *reg |= bit
 #define fio_digitalWrite_SWITCH(reg,bit) *reg ^= bit
 #define fio_digitalWrite_SWITCHTO(reg,bit,val) fio_digitalWrite_SWITCH(reg,bit)
+#define fio_digitalWrite_PORT(reg,mask,val) *(reg) = (*(reg) & ~(mask)) | ((val) & (mask))
 #else
 // reg -> dummy NULL, bit -> pin
 #define fio_digitalWrite_HIGH(reg,bit) digitalWrite(bit,HIGH)
@@ -190,15 +401,19 @@ int fio_digitalRead ( fio_register pinRegister, fio_bit pinBit );
  @param clockRegister[in] Register of data pin - ignored if fast digital write is disabled
  @param clockBit[in] Bit of data pin - Pin if fast digital write is disabled
  @param bitOrder[in] bit order
+ @param atomic[in] critical section policy, FIO_ATOMIC_BIT, FIO_ATOMIC_BYTE or
+ FIO_ATOMIC_NONE, the one set with fio_setAtomic() by default
  */
 void fio_shiftOut( fio_register dataRegister, fio_bit dataBit, fio_register clockRegister, 
-                  fio_bit clockBit, uint8_t value, uint8_t bitOrder );
+                  fio_bit clockBit, uint8_t value, uint8_t bitOrder,
+                  uint8_t atomic = fio_atomic );
 
 /*!
  @method
  @abstract faster shift out clear
  @discussion using fast digital write
  @discussion falls back to normal digitalWrite if fastio is disabled
+ @discussion a single critical section unless the policy is FIO_ATOMIC_NONE
  @param dataRegister[in] Register of data pin - ignored if fast digital write is disabled
  @param dataBit[in] Bit of data pin - Pin if fast digital write is disabled
  @param clockRegister[in] Register of data pin - ignored if fast digital write is disabled
@@ -0,0 +1,354 @@
+// ---------------------------------------------------------------------------
+// Copyright (C) - 2026
+//
+//    This program is free software: you can redistribute it and/or modify
+//    it under the terms of the GNU General Public License as published by
+//    the Free Software Foundation, either version 3 of the License, or
+//    any later version.
+//
+//    This program is distributed in the hope that it will be useful,
+//    but WITHOUT ANY WARRANTY; without even the implied warranty of
+//    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//    GNU General Public License for more details.
+//
+//    You should have received a copy of the GNU General Public License v3.0
+//    along with this program.
+//    If not, see <https://www.gnu.org/licenses/gpl-3.0.en.html>.
+//
+// ---------------------------------------------------------------------------
+//
+// Thread Safe: No
+// Extendable: Yes
+//
+// @file FastPin.h
+// This file implements compile time pin descriptors for the fast IO routines.
+//
+// @brief
+// FastPin<pin> resolves the port and bit of a constant pin at compile time.
+// On the AVR boards with a known pin layout (ATmega328P/168 - UNO, Nano,
+// ATmega32U4 - Leonardo, Micro and ATmega1280/2560 - Mega) every write
+// compiles to a single sbi/cbi instruction for ports A to G, and to a
+// constant address read-modify-write for the rest. On any other board or
+// pin the register and bit are looked up once by begin() and the fio_*
+// routines are used.
+//
+// fio_shiftOut<DATA, CLOCK>() is an unrolled shift out using two FastPins.
+// When both pins are sbi/cbi capable it is a cycle exact sequence of 9
+// cycles per bit with no critical sections since sbi and cbi are atomic.
+//
+// @version API 1.0.0
+//
+// ---------------------------------------------------------------------------
+#ifndef _FAST_PIN_H_
+#define _FAST_PIN_H_
+
+#include "FastIO.h"
+
+/*!
+ @class
+ @abstract   fio_pinTraits
+ @discussion Compile time description of a pin: data space address of its
+ PORT register and bit number. known is 0 for pins without a description.
+ */
+template <uint8_t PIN>
+struct fio_pinTraits
+{
+   enum { known = 0, addr = 0, bit = 0 };
+};
+
+#if defined(__AVR__) && !defined(CORE_TEENSY)
+
+// PORTx data space addresses
+#if defined(__AVR_ATmega8__)
+// ATmega8: same pins as the ATmega328, older I/O map
+#define FIO_PORTB 0x38
+#define FIO_PORTC 0x35
+#define FIO_PORTD 0x32
+#else
+#define FIO_PORTA 0x22
+#define FIO_PORTB 0x25
+#define FIO_PORTC 0x28
+#define FIO_PORTD 0x2B
+#endif
+#define FIO_PORTE 0x2E
+#define FIO_PORTF 0x31
+#define FIO_PORTG 0x34
+#define FIO_PORTH 0x102
+#define FIO_PORTJ 0x105
+#define FIO_PORTK 0x108
+#define FIO_PORTL 0x10B
+
+#define FIO_PIN(pin, port, pbit) \
+   template <> struct fio_pinTraits<pin> \
+   { enum { known = 1, addr = FIO_PORT##port, bit = pbit }; };
+
+#if defined(__AVR_ATmega328P__) || defined(__AVR_ATmega328__) || \
+    defined(__AVR_ATmega168__) || defined(__AVR_ATmega168P__) || \
+    defined(__AVR_ATmega88__) || defined(__AVR_ATmega88P__) || \
+    defined(__AVR_ATmega8__)
+FIO_PIN( 0, D, 0) FIO_PIN( 1, D, 1) FIO_PIN( 2, D, 2) FIO_PIN( 3, D, 3)
+FIO_PIN( 4, D, 4) FIO_PIN( 5, D, 5) FIO_PIN( 6, D, 6) FIO_PIN( 7, D, 7)
+FIO_PIN( 8, B, 0) FIO_PIN( 9, B, 1) FIO_PIN(10, B, 2) FIO_PIN(11, B, 3)
+FIO_PIN(12, B, 4) FIO_PIN(13, B, 5) FIO_PIN(14, C, 0) FIO_PIN(15, C, 1)
+FIO_PIN(16, C, 2) FIO_PIN(17, C, 3) FIO_PIN(18, C, 4) FIO_PIN(19, C, 5)
+
+#elif defined(__AVR_ATmega32U4__)
+FIO_PIN( 0, D, 2) FIO_PIN( 1, D, 3) FIO_PIN( 2, D, 1) FIO_PIN( 3, D, 0)
+FIO_PIN( 4, D, 4) FIO_PIN( 5, C, 6) FIO_PIN( 6, D, 7) FIO_PIN( 7, E, 6)
+FIO_PIN( 8, B, 4) FIO_PIN( 9, B, 5) FIO_PIN(10, B, 6) FIO_PIN(11, B, 7)
+FIO_PIN(12, D, 6) FIO_PIN(13, C, 7) FIO_PIN(14, B, 3) FIO_PIN(15, B, 1)
+FIO_PIN(16, B, 2) FIO_PIN(17, B, 0) FIO_PIN(18, F, 7) FIO_PIN(19, F, 6)
+FIO_PIN(20, F, 5) FIO_PIN(21, F, 4) FIO_PIN(22, F, 1) FIO_PIN(23, F, 0)
+
+#elif defined(__AVR_ATmega2560__) || defined(__AVR_ATmega1280__)
+FIO_PIN( 0, E, 0) FIO_PIN( 1, E, 1) FIO_PIN( 2, E, 4) FIO_PIN( 3, E, 5)
+FIO_PIN( 4, G, 5) FIO_PIN( 5, E, 3) FIO_PIN( 6, H, 3) FIO_PIN( 7, H, 4)
+FIO_PIN( 8, H, 5) FIO_PIN( 9, H, 6) FIO_PIN(10, B, 4) FIO_PIN(11, B, 5)
+FIO_PIN(12, B, 6) FIO_PIN(13, B, 7) FIO_PIN(14, J, 1) FIO_PIN(15, J, 0)
+FIO_PIN(16, H, 1) FIO_PIN(17, H, 0) FIO_PIN(18, D, 3) FIO_PIN(19, D, 2)
+FIO_PIN(20, D, 1) FIO_PIN(21, D, 0) FIO_PIN(22, A, 0) FIO_PIN(23, A, 1)
+FIO_PIN(24, A, 2) FIO_PIN(25, A, 3) FIO_PIN(26, A, 4) FIO_PIN(27, A, 5)
+FIO_PIN(28, A, 6) FIO_PIN(29, A, 7) FIO_PIN(30, C, 7) FIO_PIN(31, C, 6)
+FIO_PIN(32, C, 5) FIO_PIN(33, C, 4) FIO_PIN(34, C, 3) FIO_PIN(35, C, 2)
+FIO_PIN(36, C, 1) FIO_PIN(37, C, 0) FIO_PIN(38, D, 7) FIO_PIN(39, G, 2)
+FIO_PIN(40, G, 1) FIO_PIN(41, G, 0) FIO_PIN(42, L, 7) FIO_PIN(43, L, 6)
+FIO_PIN(44, L, 5) FIO_PIN(45, L, 4) FIO_PIN(46, L, 3) FIO_PIN(47, L, 2)
+FIO_PIN(48, L, 1) FIO_PIN(49, L, 0) FIO_PIN(50, B, 3) FIO_PIN(51, B, 2)
+FIO_PIN(52, B, 1) FIO_PIN(53, B, 0) FIO_PIN(54, F, 0) FIO_PIN(55, F, 1)
+FIO_PIN(56, F, 2) FIO_PIN(57, F, 3) FIO_PIN(58, F, 4) FIO_PIN(59, F, 5)
+FIO_PIN(60, F, 6) FIO_PIN(61, F, 7) FIO_PIN(62, K, 0) FIO_PIN(63, K, 1)
+FIO_PIN(64, K, 2) FIO_PIN(65, K, 3) FIO_PIN(66, K, 4) FIO_PIN(67, K, 5)
+FIO_PIN(68, K, 6) FIO_PIN(69, K, 7)
+#endif
+
+#undef FIO_PIN
+#endif // __AVR__ pin layouts
+
+/*!
+ @defined
+ @abstract   Critical section for run time FastPin writes.
+ @discussion Only needed where a write is a read-modify-write of the port,
+ the set/clear register backends and the fallback are atomic already.
+ */
+#if defined(FIO_OUTSET) || defined(FIO_BSRR) || defined(FIO_FALLBACK)
+#define FIO_PIN_ATOMIC(op) op
+#else
+#define FIO_PIN_ATOMIC(op) ATOMIC_BLOCK(ATOMIC_RESTORESTATE) { op; }
+#endif
+
+/*!
+ @class
+ @abstract   FastPin
+ @discussion Digital output with the pin resolved at compile time. begin()
+ must be called before any write.
+ */
+template <uint8_t PIN>
+class FastPin
+{
+public:
+   enum
+   {
+      pin     = PIN,
+      // single instruction, atomic, set and clear (sbi/cbi)
+      bitOp   = ( fio_pinTraits<PIN>::known && ( fio_pinTraits<PIN>::addr < 0x40 ) ),
+      ioAddr  = fio_pinTraits<PIN>::addr - 0x20,
+      bitNum  = fio_pinTraits<PIN>::bit
+   };
+
+   /*!
+    @function
+    @abstract   Configures the pin as an output.
+    @param      initial_state[in] level to drive the pin with (LOW, HIGH, SKIP).
+    */
+   static inline void begin ( uint8_t initial_state = LOW )
+   {
+      _reg = fio_pinToOutputRegister ( PIN, initial_state );
+      _bit = fio_pinToBit ( PIN );
+   }
+
+   /*!
+    @function
+    @abstract   Drives the pin HIGH.
+    */
+   static inline void high ( void )
+   {
+#if defined(__AVR__)
+      if ( fio_pinTraits<PIN>::known )
+      {
+         if ( bitOp )
+         {
+            *port() |= _BV(bitNum);
+         }
+         else
+         {
+            ATOMIC_BLOCK(ATOMIC_RESTORESTATE) { *port() |= _BV(bitNum); }
+         }
+         return;
+      }
+#endif
+      FIO_PIN_ATOMIC(fio_digitalWrite_HIGH ( _reg, _bit ));
+   }
+
+   /*!
+    @function
+    @abstract   Drives the pin LOW.
+    */
+   static inline void low ( void )
+   {
+#if defined(__AVR__)
+      if ( fio_pinTraits<PIN>::known )
+      {
+         if ( bitOp )
+         {
+            *port() &= ~_BV(bitNum);
+         }
+         else
+         {
+            ATOMIC_BLOCK(ATOMIC_RESTORESTATE) { *port() &= ~_BV(bitNum); }
+         }
+         return;
+      }
+#endif
+      FIO_PIN_ATOMIC(fio_digitalWrite_LOW ( _reg, _bit ));
+   }
+
+   /*!
+    @function
+    @abstract   Drives the pin to a given level.
+    @param      value[in] LOW or HIGH.
+    */
+   static inline void write ( uint8_t value )
+   {
+      if ( value )
+      {
+         high ( );
+      }
+      else
+      {
+         low ( );
+      }
+   }
+
+private:
+#if defined(__AVR__)
+   static inline volatile uint8_t *port ( void )
+   {
+      return ( (volatile uint8_t *)fio_pinTraits<PIN>::addr );
+   }
+#endif
+   static fio_register _reg;  // run time register for unknown pins
+   static fio_bit      _bit;  // run time bit for unknown pins
+};
+
+template <uint8_t PIN> fio_register FastPin<PIN>::_reg;
+template <uint8_t PIN> fio_bit      FastPin<PIN>::_bit;
+
+
+/*!
+ @class
+ @abstract   fio_shifter
+ @discussion Unrolled shift out of a byte through two FastPins. The AVR
+ specialisation is used when both pins are sbi/cbi capable.
+ */
+template <class DATA, class CLOCK, bool BITOP>
+struct fio_shifter
+{
+   static inline void shiftOut ( uint8_t value, uint8_t bitOrder )
+   {
+      if ( bitOrder == LSBFIRST )
+      {
+         shiftBit ( value & 0x01 ); shiftBit ( value & 0x02 );
+         shiftBit ( value & 0x04 ); shiftBit ( value & 0x08 );
+         shiftBit ( value & 0x10 ); shiftBit ( value & 0x20 );
+         shiftBit ( value & 0x40 ); shiftBit ( value & 0x80 );
+      }
+      else
+      {
+         shiftBit ( value & 0x80 ); shiftBit ( value & 0x40 );
+         shiftBit ( value & 0x20 ); shiftBit ( value & 0x10 );
+         shiftBit ( value & 0x08 ); shiftBit ( value & 0x04 );
+         shiftBit ( value & 0x02 ); shiftBit ( value & 0x01 );
+      }
+   }
+
+private:
+   static inline void shiftBit ( uint8_t value )
+   {
+      DATA::write ( value );
+      CLOCK::high ( );
+      CLOCK::low ( );
+   }
+};
+
+#if defined(__AVR__)
+// Exactly one of the data sbi/cbi is executed per bit: 5 cycles for the data
+// line plus 4 for the clock pulse, regardless of the value of the bit.
+#define FIO_SHIFT_BIT(n) \
+   "sbrc %[val], " #n "\n\t" \
+   "sbi  %[dport], %[dbit]\n\t" \
+   "sbrs %[val], " #n "\n\t" \
+   "cbi  %[dport], %[dbit]\n\t" \
+   "sbi  %[cport], %[cbit]\n\t" \
+   "cbi  %[cport], %[cbit]\n\t"
+
+template <class DATA, class CLOCK>
+struct fio_shifter<DATA, CLOCK, true>
+{
+   static inline void shiftOut ( uint8_t value, uint8_t bitOrder )
+   {
+      if ( bitOrder == LSBFIRST )
+      {
+         __asm__ __volatile__ (
+            FIO_SHIFT_BIT(0) FIO_SHIFT_BIT(1) FIO_SHIFT_BIT(2) FIO_SHIFT_BIT(3)
+            FIO_SHIFT_BIT(4) FIO_SHIFT_BIT(5) FIO_SHIFT_BIT(6) FIO_SHIFT_BIT(7)
+            :
+            : [val] "r" (value),
+              [dport] "I" (DATA::ioAddr), [dbit] "I" (DATA::bitNum),
+              [cport] "I" (CLOCK::ioAddr), [cbit] "I" (CLOCK::bitNum) );
+      }
+      else
+      {
+         __asm__ __volatile__ (
+            FIO_SHIFT_BIT(7) FIO_SHIFT_BIT(6) FIO_SHIFT_BIT(5) FIO_SHIFT_BIT(4)
+            FIO_SHIFT_BIT(3) FIO_SHIFT_BIT(2) FIO_SHIFT_BIT(1) FIO_SHIFT_BIT(0)
+            :
+            : [val] "r" (value),
+              [dport] "I" (DATA::ioAddr), [dbit] "I" (DATA::bitNum),
+              [cport] "I" (CLOCK::ioAddr), [cbit] "I" (CLOCK::bitNum) );
+      }
+   }
+};
+#undef FIO_SHIFT_BIT
+#endif // __AVR__
+
+/*!
+ @function
+ @abstract   Unrolled shift out through compile time pins.
+ @discussion Both pins must have been configured with FastPin::begin().
+ @param      value[in] byte to shift out.
+ @param      bitOrder[in] MSBFIRST or LSBFIRST.
+ */
+template <class DATA, class CLOCK>
+inline void fio_shiftOut ( uint8_t value, uint8_t bitOrder = MSBFIRST )
+{
+   fio_shifter<DATA, CLOCK, (DATA::bitOp && CLOCK::bitOp)>::shiftOut ( value, bitOrder );
+}
+
+/*!
+ @function
+ @abstract   Unrolled shift out of 0x00 through compile time pins.
+ @discussion Clears the shift register without touching the data line
+ between clocks.
+ */
+template <class DATA, class CLOCK>
+inline void fio_shiftOut ( void )
+{
+   DATA::low ( );
+   for ( uint8_t i = 0; i < 8; i++ )
+   {
+      CLOCK::high ( );
+      CLOCK::low ( );
+   }
+}
+
+#endif // _FAST_PIN_H_
@@ -199,6 +199,35 @@ uint8_t I2CIO::digitalRead ( uint8_t pin )
    return (pinVal);
 }
 
+//
+// write
+int I2CIO::write ( const uint8_t *values, uint8_t count )
+{
+   int status = 0;
+   
+   if ( _initialised )
+   {
+      while ( ( count > 0 ) && ( status == 0 ) )
+      {
+         uint8_t batch = ( count > I2CIO_BATCH ) ? I2CIO_BATCH : count;
+         
+         Wire.beginTransmission ( _i2cAddr );
+         for ( uint8_t i = 0; i < batch; i++ )
+         {
+            _shadow = ( *values++ | _dirMask );
+#if (ARDUINO <  100)
+            Wire.send ( _shadow );
+#else
+            Wire.write ( _shadow );
+#endif
+         }
+         status = Wire.endTransmission ();
+         count -= batch;
+      }
+   }
+   return ( (status == 0) );
+}
+
 //
 // digitalWrite
 int I2CIO::digitalWrite ( uint8_t pin, uint8_t level )
@@ -46,6 +46,18 @@
 
 #define _I2CIO_VERSION "1.0.0"
 
+/*!
+ @defined
+ @abstract   Port values sent per I2C transaction by write(values, count).
+ @discussion Fits the transmit buffer of Wire (32 bytes) and of TinyWireM
+ (18 bytes, I2C address included).
+ */
+#if defined(__AVR_ATtiny84__) || (__AVR_ATtiny2313__) || defined (__AVR_ATtiny85__)
+#define I2CIO_BATCH 16
+#else
+#define I2CIO_BATCH 32
+#endif
+
 /*!
  @class
  @abstract    I2CIO
@@ -137,6 +149,20 @@ public:
     */   
    int write ( uint8_t value );
    
+   /*!
+    @method
+    @abstract   Writes a sequence of values to the device.
+    @discussion Same as write(value) for each value, the values are sent
+    I2CIO_BATCH at a time in a single I2C transaction. The device updates
+    its port after each byte received, so the values appear on the pins one
+    after the other without the overhead of a transaction each.
+    
+    @param      values[in] values to be written to the device.
+    @param      count[in] number of values.
+    @result     1 on success, 0 otherwise
+    */   
+   int write ( const uint8_t *values, uint8_t count );
+   
    /*!
     @method
     @abstract   Writes a digital level to a particular pin.
@@ -63,7 +63,12 @@
 // Constructor
 LCD::LCD () 
 {
-   
+   _controllers = 1;
+   _controller  = LCD_CONTROLLER_1;
+   _shift       = 0;
+   _page        = 0;
+   _drawOffset  = 0;
+   _glyphSet    = LCD_GLYPHS_NONE;
 }
 
 // PUBLIC METHODS
@@ -96,6 +101,12 @@ void LCD::begin(uint8_t cols, uint8_t lines, uint8_t dotsize)
    }
    _numlines = lines;
    _cols = cols;
+   _glyphSet = LCD_GLYPHS_NONE;   // CGRAM content is undefined after power up
+   
+   // Dual controller displays: every init command goes to both controllers,
+   // sharing the waits below
+   // ------------------------------------------------------------
+   _controller = LCD_CONTROLLER_ALL;
    
    // for some 1 line displays you can select a 10 pixel high font
    // ------------------------------------------------------------
@@ -163,13 +174,15 @@ void LCD::begin(uint8_t cols, uint8_t lines, uint8_t dotsize)
    _displaycontrol = LCD_DISPLAYON | LCD_CURSOROFF | LCD_BLINKOFF;  
    display();
    
-   // clear the LCD
+   // clear the LCD, ending any page being drawn
+   _page = 0;
+   _drawOffset = 0;
    clear();
    
    // Initialize to default text direction (for romance languages)
    _displaymode = LCD_ENTRYLEFT | LCD_ENTRYSHIFTDECREMENT;
    // set the entry mode
-   command(LCD_ENTRYMODESET | _displaymode);
+   commandAll(LCD_ENTRYMODESET | _displaymode);
 
    backlight();
 
@@ -179,14 +192,43 @@ void LCD::begin(uint8_t cols, uint8_t lines, uint8_t dotsize)
 // ---------------------------------------------------------------------------
 void LCD::clear()
 {
+   // Only the hidden page while one is being drawn
+   if ( drawingPage() )
+   {
+      erasePage();
+      return;
+   }
+   
+   // Both controllers of a dual controller display clear at the same time
+   _controller = LCD_CONTROLLER_ALL;
    command(LCD_CLEARDISPLAY);             // clear display, set cursor position to zero
    delayMicroseconds(HOME_CLEAR_EXEC);    // this command is time consuming
+   selectController(LCD_CONTROLLER_1);
+   
+   // The display shift is reset as well
+   _shift = 0;
+   _page = 0;
+   _drawOffset = 0;
 }
 
 void LCD::home()
 {
+   // Return home would show the page being drawn
+   if ( drawingPage() )
+   {
+      setCursor(0, 0);
+      return;
+   }
+   
+   _controller = LCD_CONTROLLER_ALL;
    command(LCD_RETURNHOME);             // set cursor position to zero
    delayMicroseconds(HOME_CLEAR_EXEC);  // This command is time consuming
+   selectController(LCD_CONTROLLER_1);
+   
+   // The display shift is reset as well
+   _shift = 0;
+   _page = 0;
+   _drawOffset = 0;
 }
 
 void LCD::setCursor(uint8_t col, uint8_t row)
@@ -199,6 +241,15 @@ void LCD::setCursor(uint8_t col, uint8_t row)
       row = _numlines-1;    // rows start at 0
    }
    
+   // Dual controller displays: two 2 line displays, one above the other
+   // ----------------------------------------
+   if ( _controllers > 1 )
+   {
+      selectController( ( row < 2 ) ? LCD_CONTROLLER_1 : LCD_CONTROLLER_2 );
+      command(LCD_SETDDRAMADDR | (col + row_offsetsDef[row & 0x01]));
+      return;
+   }
+   
    // 16x4 LCDs have special memory map layout
    // ----------------------------------------
    if ( _cols == 16 && _numlines == 4 )
@@ -207,7 +258,7 @@ void LCD::setCursor(uint8_t col, uint8_t row)
    }
    else 
    {
-      command(LCD_SETDDRAMADDR | (col + row_offsetsDef[row]));
+      command(LCD_SETDDRAMADDR | (col + _drawOffset + row_offsetsDef[row]));
    }
    
 }
@@ -216,63 +267,125 @@ void LCD::setCursor(uint8_t col, uint8_t row)
 void LCD::noDisplay() 
 {
    _displaycontrol &= ~LCD_DISPLAYON;
-   command(LCD_DISPLAYCONTROL | _displaycontrol);
+   displayControl();
 }
 
 void LCD::display() 
 {
    _displaycontrol |= LCD_DISPLAYON;
-   command(LCD_DISPLAYCONTROL | _displaycontrol);
+   displayControl();
 }
 
 // Turns the underline cursor on/off
 void LCD::noCursor() 
 {
    _displaycontrol &= ~LCD_CURSORON;
-   command(LCD_DISPLAYCONTROL | _displaycontrol);
+   displayControl();
 }
 void LCD::cursor() 
 {
    _displaycontrol |= LCD_CURSORON;
-   command(LCD_DISPLAYCONTROL | _displaycontrol);
+   displayControl();
 }
 
 // Turns on/off the blinking cursor
 void LCD::noBlink() 
 {
    _displaycontrol &= ~LCD_BLINKON;
-   command(LCD_DISPLAYCONTROL | _displaycontrol);
+   displayControl();
 }
 
 void LCD::blink() 
 {
    _displaycontrol |= LCD_BLINKON;
-   command(LCD_DISPLAYCONTROL | _displaycontrol);
+   displayControl();
 }
 
 // These commands scroll the display without changing the RAM
 void LCD::scrollDisplayLeft(void) 
 {
-   command(LCD_CURSORSHIFT | LCD_DISPLAYMOVE | LCD_MOVELEFT);
+   commandAll(LCD_CURSORSHIFT | LCD_DISPLAYMOVE | LCD_MOVELEFT);
+   _shift = ( _shift + 1 ) % ddramWidth();
 }
 
 void LCD::scrollDisplayRight(void) 
 {
-   command(LCD_CURSORSHIFT | LCD_DISPLAYMOVE | LCD_MOVERIGHT);
+   commandAll(LCD_CURSORSHIFT | LCD_DISPLAYMOVE | LCD_MOVERIGHT);
+   _shift = ( _shift + ddramWidth() - 1 ) % ddramWidth();
+}
+
+// Page flipping through the hidden DDRAM columns
+uint8_t LCD::beginPage(uint8_t erase)
+{
+   if ( ( _numlines > 2 ) || ( _cols * 2 > ddramWidth() ) )
+   {
+      return 0;
+   }
+   
+   // Draw on the page not shown
+   _drawOffset = _page ? 0 : _cols;
+   
+   if ( erase )
+   {
+      erasePage();
+   }
+   else
+   {
+      setCursor(0, 0);
+   }
+   return 1;
+}
+
+void LCD::flipPage()
+{
+   uint8_t page = ( _drawOffset == 0 ) ? 0 : 1;
+   
+   if ( page != _page )
+   {
+      // Page shown first, home() would otherwise keep the shift
+      _page = page;
+      shiftTo(_drawOffset);
+   }
+}
+
+bool LCD::drawingPage()
+{
+   return ( _drawOffset != ( _page ? _cols : 0 ) );
+}
+
+void LCD::erasePage()
+{
+   uint8_t spaces[LCD_STREAM_CHUNK];
+   
+   memset ( spaces, ' ', sizeof ( spaces ) );
+   for ( uint8_t row = 0; row < _numlines; row++ )
+   {
+      uint8_t count = _cols;
+      
+      setCursor(0, row);
+      while ( count > 0 )
+      {
+         uint8_t chunk = ( count > sizeof ( spaces ) ) ? sizeof ( spaces ) : count;
+         
+         write(spaces, chunk);
+         count -= chunk;
+      }
+   }
+   setCursor(0, 0);
 }
 
 // This is for text that flows Left to Right
 void LCD::leftToRight(void) 
 {
    _displaymode |= LCD_ENTRYLEFT;
-   command(LCD_ENTRYMODESET | _displaymode);
+   commandAll(LCD_ENTRYMODESET | _displaymode);
 }
 
 // This is for text that flows Right to Left
 void LCD::rightToLeft(void) 
 {
    _displaymode &= ~LCD_ENTRYLEFT;
-   command(LCD_ENTRYMODESET | _displaymode);
+   commandAll(LCD_ENTRYMODESET | _displaymode);
 }
 
 // This method moves the cursor one space to the right
@@ -292,21 +405,26 @@ void LCD::moveCursorLeft(void)
 void LCD::autoscroll(void) 
 {
    _displaymode |= LCD_ENTRYSHIFTINCREMENT;
-   command(LCD_ENTRYMODESET | _displaymode);
+   commandAll(LCD_ENTRYMODESET | _displaymode);
 }
 
 // This will 'left justify' text from the cursor
 void LCD::noAutoscroll(void) 
 {
    _displaymode &= ~LCD_ENTRYSHIFTINCREMENT;
-   command(LCD_ENTRYMODESET | _displaymode);
+   commandAll(LCD_ENTRYMODESET | _displaymode);
 }
 
 // Write to CGRAM of new characters
 void LCD::createChar(uint8_t location, uint8_t charmap[]) 
 {
+   uint8_t controller = _controller;
+   
    location &= 0x7;            // we only have 8 locations 0-7
    
+   // Each controller of a dual controller display has its own CGRAM
+   _controller = LCD_CONTROLLER_ALL;
+   _glyphSet   = LCD_GLYPHS_NONE;
    command(LCD_SETCGRAMADDR | (location << 3));
    delayMicroseconds(30);
    
@@ -315,13 +433,18 @@ void LCD::createChar(uint8_t location, uint8_t charmap[])
       write(charmap[i]);      // call the virtual write method
       delayMicroseconds(40);
    }
+   _controller = controller;
 }
 
 #ifdef __AVR__
 void LCD::createChar(uint8_t location, const char *charmap)
 {
+   uint8_t controller = _controller;
+   
    location &= 0x7;   // we only have 8 memory locations 0-7
    
+   _controller = LCD_CONTROLLER_ALL;
+   _glyphSet   = LCD_GLYPHS_NONE;
    command(LCD_SETCGRAMADDR | (location << 3));
    delayMicroseconds(30);
    
@@ -330,9 +453,27 @@ void LCD::createChar(uint8_t location, const char *charmap)
       write(pgm_read_byte_near(charmap++));
       delayMicroseconds(40);
    }
+   _controller = controller;
 }
 #endif // __AVR__
 
+void LCD::updateChar(uint8_t location, uint8_t row, const uint8_t rows[],
+                     uint8_t count)
+{
+   uint8_t controller = _controller;
+   
+   _controller = LCD_CONTROLLER_ALL;
+   _glyphSet   = LCD_GLYPHS_NONE;
+   command(LCD_SETCGRAMADDR | ((location & 0x7) << 3) | (row & 0x7));
+   
+   // The CGRAM address increments after each write
+   for (uint8_t i = 0; i < count; i++)
+   {
+      write(rows[i]);
+   }
+   _controller = controller;
+}
+
 //
 // Switch on the backlight
 void LCD::backlight ( void )
@@ -382,3 +523,247 @@ size_t LCD::write(uint8_t value)
    return 1;             // assume OK
 }
 #endif
+
+#if (ARDUINO <  100)
+void LCD::write(const uint8_t *buffer, size_t size)
+{
+   while (size--)
+   {
+      send(*buffer++, LCD_DATA);
+   }
+}
+#else
+size_t LCD::write(const uint8_t *buffer, size_t size)
+{
+   for (size_t i = 0; i < size; i++)
+   {
+      send(buffer[i], LCD_DATA);
+   }
+   return size;          // assume OK
+}
+#endif
+
+// Powers of ten subtracted by printFixed() to convert without divisions
+static const uint32_t powersOf10[] PROGMEM =
+{
+   1000000000UL, 100000000UL, 10000000UL, 1000000UL, 100000UL,
+   10000UL, 1000UL, 100UL, 10UL
+};
+
+//
+// printInt
+void LCD::printInt(long value, uint8_t width, char pad)
+{
+   printFixed(value, 0, width, pad);
+}
+
+//
+// printFixed
+void LCD::printFixed(long value, uint8_t decimals, uint8_t width, char pad)
+{
+   char field[LCD_FIELD_MAX];
+   
+   width = formatFixed(field, value, decimals, width, pad);
+   write((const uint8_t *)field, width);
+}
+
+//
+// formatFixed
+uint8_t LCD::formatFixed(char field[], long value, uint8_t decimals,
+                         uint8_t width, char pad)
+{
+   char          digits[10];
+   unsigned long n = (value < 0) ? 0UL - (unsigned long)value : value;
+   uint8_t       count = 0;
+   uint8_t       shown;
+   uint8_t       pos;
+   
+   if (width > LCD_FIELD_MAX)
+   {
+      width = LCD_FIELD_MAX;
+   }
+   
+   // Each digit is the number of times its power of ten can be subtracted
+   // ------------------------------------------------------------
+   for (uint8_t i = 0; i < sizeof(powersOf10) / sizeof(powersOf10[0]); i++)
+   {
+      uint32_t power = pgm_read_dword(&powersOf10[i]);
+      char     digit = '0';
+      
+      while (n >= power)
+      {
+         n -= power;
+         digit++;
+      }
+      if ((digit != '0') || (count != 0))
+      {
+         digits[count++] = digit;
+      }
+   }
+   digits[count++] = '0' + n;
+   
+   // Digits shown, with a zero before the decimal point
+   shown = (decimals >= count) ? decimals + 1 : count;
+   
+   if (shown + (decimals ? 1 : 0) + (value < 0 ? 1 : 0) > width)
+   {
+      memset(field, '*', width);
+   }
+   else
+   {
+      // Fill the field from the right
+      // ------------------------------------------------------------
+      pos = width;
+      for (uint8_t k = 0; k < shown; k++)
+      {
+         if (decimals && (k == decimals))
+         {
+            field[--pos] = '.';
+         }
+         field[--pos] = (k < count) ? digits[count - 1 - k] : '0';
+      }
+      
+      if ((value < 0) && (pad != '0'))
+      {
+         field[--pos] = '-';
+      }
+      memset(field, pad, pos);
+      if ((value < 0) && (pad == '0'))
+      {
+         field[0] = '-';
+      }
+   }
+   return width;
+}
+
+//
+// writeP
+void LCD::writeP(const uint8_t *data, size_t size)
+{
+   uint8_t chunk[LCD_STREAM_CHUNK];
+   
+   while (size > 0)
+   {
+      uint8_t count = (size > LCD_STREAM_CHUNK) ? LCD_STREAM_CHUNK : size;
+      
+      for (uint8_t i = 0; i < count; i++)
+      {
+         chunk[i] = pgm_read_byte(data++);
+      }
+      write(chunk, count);
+      size -= count;
+   }
+}
+
+//
+// printP
+void LCD::printP(const char *str)
+{
+   writeP((const uint8_t *)str, strlen_P(str));
+}
+
+#if (ARDUINO >= 100)
+//
+// print
+size_t LCD::print(const __FlashStringHelper *str)
+{
+   size_t size = strlen_P((const char *)str);
+   
+   writeP((const uint8_t *)str, size);
+   return size;
+}
+#endif
+
+//
+// loadScreen
+void LCD::loadScreen(const uint8_t *screen)
+{
+   uint8_t address = pgm_read_byte(screen++);
+   uint8_t length  = pgm_read_byte(screen++);
+   
+   while (length != 0)
+   {
+      if ( _controllers > 1 )
+      {
+         selectController((address & 0x80) ? LCD_CONTROLLER_2 : LCD_CONTROLLER_1);
+         command(LCD_SETDDRAMADDR | (address & 0x7F));
+      }
+      else
+      {
+         command(LCD_SETDDRAMADDR | (address + _drawOffset));
+      }
+      writeP(screen, length);
+      
+      screen += length;
+      address = pgm_read_byte(screen++);
+      length  = pgm_read_byte(screen++);
+   }
+}
+
+// PRIVATE METHODS
+// ---------------------------------------------------------------------------
+void LCD::commandAll(uint8_t value)
+{
+   uint8_t controller = _controller;
+   
+   _controller = LCD_CONTROLLER_ALL;
+   command(value);
+   _controller = controller;
+}
+
+void LCD::displayControl()
+{
+   // The other controller keeps the display on/off state without the cursor
+   if ( ( _controllers > 1 ) && ( _controller != LCD_CONTROLLER_ALL ) )
+   {
+      uint8_t controller = _controller;
+      
+      _controller = LCD_CONTROLLER_ALL & ~controller;
+      command(LCD_DISPLAYCONTROL | (_displaycontrol & ~(LCD_CURSORON | LCD_BLINKON)));
+      _controller = controller;
+   }
+   command(LCD_DISPLAYCONTROL | _displaycontrol);
+}
+
+uint8_t LCD::ddramWidth()
+{
+   return ( _displayfunction & LCD_2LINE ) ? 40 : 80;
+}
+
+void LCD::shiftTo(uint8_t column)
+{
+   uint8_t width = ddramWidth();
+   uint8_t left  = ( column + width - _shift ) % width;
+   
+   if ( column == 0 )
+   {
+      home();              // resets the shift in one command
+      return;
+   }
+   if ( left <= width / 2 )
+   {
+      while ( left-- )
+      {
+         scrollDisplayLeft();
+      }
+   }
+   else
+   {
+      for ( left = width - left; left; left-- )
+      {
+         scrollDisplayRight();
+      }
+   }
+}
+
+void LCD::selectController(uint8_t controller)
+{
+   if ( controller != _controller )
+   {
+      _controller = controller;
+      if ( ( _controllers > 1 ) && ( _displaycontrol & (LCD_CURSORON | LCD_BLINKON) ) )
+      {
+         displayControl();
+      }
+   }
+}
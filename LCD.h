@@ -163,6 +163,50 @@ inline static void waitUsec ( uint16_t uSec )
 #define LCD_DATA                1
 #define FOUR_BITS               2
 
+// Controllers addressed by send() on dual controller (40x4) displays
+// ---------------------------------------------------------------------------
+#define LCD_CONTROLLER_1        0x01
+#define LCD_CONTROLLER_2        0x02
+#define LCD_CONTROLLER_ALL      0x03
+
+// Custom character sets held in CGRAM, see setGlyphSet()
+// Each set takes the custom characters of the others: components using
+// different sets can't be shown together, the last one drawn wins and the
+// others load their set back on their next update.
+// ---------------------------------------------------------------------------
+#define LCD_GLYPHS_NONE         0x00
+#define LCD_GLYPHS_BIGDIGIT     0x01
+#define LCD_GLYPHS_BIGDIGIT_RND 0x02
+#define LCD_GLYPHS_HBAR         0x03
+#define LCD_GLYPHS_VBAR         0x04
+#define LCD_GLYPHS_CANVAS       0x05
+#define LCD_GLYPHS_ANIMATOR     0x06
+#define LCD_GLYPHS_UTF8         0x07
+#define LCD_GLYPHS_USER         0x80    // first id free for the application
+
+/*!
+ @defined
+ @abstract   Maximum width of the printInt() and printFixed() fields.
+ */
+#define LCD_FIELD_MAX           20
+
+/*!
+ @defined
+ @abstract   Characters copied from program memory per write() call.
+ */
+#define LCD_STREAM_CHUNK        16
+
+/*!
+ @defined
+ @abstract   Records of a screen image, see loadScreen().
+ @discussion LCD_SCREEN_RUN(address, length) precedes length characters
+ written from a DDRAM address, LCD_SCREEN_RUN2() the same on the second
+ controller of 40x4 displays. LCD_SCREEN_END ends the image.
+ */
+#define LCD_SCREEN_RUN(address, length)   (uint8_t)(address), (uint8_t)(length)
+#define LCD_SCREEN_RUN2(address, length)  (uint8_t)(0x80 | (address)), (uint8_t)(length)
+#define LCD_SCREEN_END                    0x00, 0x00
+
 
 /*!
  @defined 
@@ -219,6 +263,10 @@ public:
     drivers. Should it not be compatible with some other LCD driver, a derived
     implementation should be done on the driver specif class.
     
+    Dual controller displays (40x4) are initialized with both controllers
+    receiving the same commands at the same time, once the driver knows the
+    second enable line.
+    
     @param      cols[in] the number of columns that the display has
     @param      rows[in] the number of rows that the display has
     @param      charsize[in] character size, default==LCD_5x8DOTS
@@ -231,7 +279,11 @@ public:
     @discussion Clears the LCD screen and positions the cursor in the upper-left 
     corner. 
     
-    This operation is time consuming for the LCD.
+    This operation is time consuming for the LCD. Both controllers of a dual
+    controller display clear at the same time.
+    
+    Between beginPage() and flipPage() only the hidden page is blanked, the
+    page shown is left as is.
     
     @param      none
     */
@@ -244,7 +296,9 @@ public:
     That is, use that location in outputting subsequent text to the display. 
     To also clear the display, use the clear() function instead.
     
-    This operation is time consuming for the LCD.
+    This operation is time consuming for the LCD. Between beginPage() and
+    flipPage() it moves the cursor to the upper-left of the hidden page and
+    leaves the display shift alone.
     
     @param      none
     */
@@ -325,6 +379,35 @@ public:
     */
    void scrollDisplayRight();
    
+   /*!
+    @function
+    @abstract   Starts drawing the next page off screen.
+    @discussion Each DDRAM line holds 40 characters (80 on 1 line displays),
+    a display of up to half that width has a second page in the hidden
+    columns. Until flipPage(), setCursor() addresses that hidden page, so the
+    page is drawn without being seen however slow the link to the LCD.
+    
+    Not available on displays with more than 2 rows or wider than half a
+    DDRAM line, the drawing then goes straight to the visible page.
+    
+    @param      erase[in] blank the hidden page first (default), it otherwise
+    keeps the page shown before the last flip.
+    @result     1 if the page is hidden, 0 if not available.
+    */
+   uint8_t beginPage(uint8_t erase = 1);
+   
+   /*!
+    @function
+    @abstract   Shows the page drawn since beginPage().
+    @discussion Moves the visible window onto the new page with display shift
+    commands (a single return home for the first page). They complete far
+    quicker than the liquid crystal response time, the page change is seen
+    at once. setCursor() then addresses the visible page again.
+    
+    @param      none
+    */
+   void flipPage();
+   
    /*!
     @function
     @abstract   Set the direction for text written to the LCD to left-to-right.
@@ -435,17 +518,79 @@ public:
    void createChar(uint8_t location, const char *charmap);
 #endif // __AVR__
    
+   /*!
+    @function
+    @abstract   Rewrites some rows of the custom characters.
+    @discussion Writes count consecutive CGRAM rows starting at a row of a
+    custom character, carrying on into the next characters. Unlike
+    createChar() it adds no delay of its own, send() already waits for every
+    write to complete.
+    
+    As with createChar(), call setCursor() before writing text again.
+    
+    @param      location[in] custom character (0 to 7).
+    @param      row[in] first row to write (0 to 7).
+    @param      rows[in] bitmap of the rows, 5 least significant bits.
+    @param      count[in] number of rows to write.
+    */
+   void updateChar(uint8_t location, uint8_t row, const uint8_t rows[],
+                   uint8_t count);
+   
    /*!
     @function
     @abstract   Position the LCD cursor.
     @discussion Sets the position of the LCD cursor. Set the location at which 
     subsequent text written to the LCD will be displayed.
     
+    Rows 2 and 3 of a dual controller display are rows 0 and 1 of the second
+    controller, the cursor (if shown) moves with them.
+    
     @param      col[in] LCD column
     @param      row[in] LCD row - line.
     */
    void setCursor(uint8_t col, uint8_t row);
    
+   /*!
+    @function
+    @abstract   Number of columns of the display.
+    @result     columns given to begin().
+    */
+   uint8_t getCols ( ) { return _cols; }
+   
+   /*!
+    @function
+    @abstract   Number of rows of the display.
+    @result     rows given to begin().
+    */
+   uint8_t getRows ( ) { return _numlines; }
+   
+   /*!
+    @function
+    @abstract   Characters of a DDRAM line.
+    @discussion Length of the line moved by the display shift.
+    @result     40 on 2 line displays, 80 on 1 line displays.
+    */
+   uint8_t ddramWidth();
+   
+   /*!
+    @function
+    @abstract   Custom character set held in CGRAM.
+    @discussion Components drawing with their own glyphs (big digits, bars)
+    check it to load their set only when another one has replaced it.
+    createChar() and begin() reset it to LCD_GLYPHS_NONE.
+    @result     LCD_GLYPHS_x id of the set last loaded.
+    */
+   uint8_t getGlyphSet ( ) { return _glyphSet; }
+   
+   /*!
+    @function
+    @abstract   Records the custom character set held in CGRAM.
+    @discussion To be called after loading the glyphs of a set with
+    createChar().
+    @param      id[in] LCD_GLYPHS_x id of the set.
+    */
+   void setGlyphSet ( uint8_t id ) { _glyphSet = id; }
+   
    /*!
     @function
     @abstract   Switch-on the LCD backlight.
@@ -533,6 +678,120 @@ public:
    virtual size_t write(uint8_t value);
 #endif
    
+   /*!
+    @function
+    @abstract   Writes a run of characters to the LCD.
+    @discussion Sends the characters to the LCD one after the other without
+    going through write(uint8_t) for each of them. Derived classes may
+    override it to batch the transfer.
+    
+    @param      buffer[in] characters to write.
+    @param      size[in] number of characters.
+    */
+#if (ARDUINO <  100)
+   virtual void write(const uint8_t *buffer, size_t size);
+#else
+   virtual size_t write(const uint8_t *buffer, size_t size);
+#endif
+   
+   /*!
+    @function
+    @abstract   Prints an integer in a fixed width field.
+    @discussion The number is right aligned and converted without divisions.
+    Leading zeros go after the sign. A number that doesn't fit fills the
+    field with '*'. The field is written with a single write() call.
+    
+    @param      value[in] number to print.
+    @param      width[in] characters of the field (1..LCD_FIELD_MAX).
+    @param      pad[in] ' ' or '0', fills the left of the field.
+    */
+   void printInt(long value, uint8_t width, char pad = ' ');
+   
+   /*!
+    @function
+    @abstract   Prints a fixed point number in a fixed width field.
+    @discussion Same as printInt() with a decimal point: value 1234 with 2
+    decimals prints "12.34", -5 with 2 decimals "-0.05".
+    
+    @param      value[in] number to print, scaled by 10^decimals.
+    @param      decimals[in] digits after the decimal point.
+    @param      width[in] characters of the field, point included
+    (1..LCD_FIELD_MAX).
+    @param      pad[in] ' ' or '0', fills the left of the field.
+    */
+   void printFixed(long value, uint8_t decimals, uint8_t width, char pad = ' ');
+   
+   /*!
+    @function
+    @abstract   Formats a fixed point number in a fixed width field.
+    @discussion Formatting of printFixed() into a buffer, for classes that
+    compare the field with what is displayed before writing it.
+    
+    @param      field[out] width characters, not terminated.
+    @param      value[in] number to format, scaled by 10^decimals.
+    @param      decimals[in] digits after the decimal point.
+    @param      width[in] characters of the field (1..LCD_FIELD_MAX).
+    @param      pad[in] ' ' or '0', fills the left of the field.
+    @result     width of the field.
+    */
+   static uint8_t formatFixed(char field[], long value, uint8_t decimals,
+                              uint8_t width, char pad = ' ');
+   
+   /*!
+    @function
+    @abstract   Writes characters stored in program memory.
+    @discussion The characters are copied LCD_STREAM_CHUNK at a time and
+    each chunk is handed to write(buffer, size) in one call, so the batched
+    write of the driver is used.
+    
+    @param      data[in] characters in program memory.
+    @param      size[in] number of characters.
+    */
+   void writeP(const uint8_t *data, size_t size);
+   
+   /*!
+    @function
+    @abstract   Prints a string stored in program memory.
+    @discussion Same as writeP() up to the terminating '\0'.
+    
+    @param      str[in] string in program memory (PSTR() or PROGMEM).
+    */
+   void printP(const char *str);
+   
+#if (ARDUINO >= 100)
+   /*!
+    @function
+    @abstract   Prints an F() string.
+    @discussion Takes the place of Print::print(), which writes the string
+    one character at a time, with printP().
+    
+    @param      str[in] string built with F().
+    @result     number of characters written.
+    */
+   size_t print(const __FlashStringHelper *str);
+   using Print::print;
+#endif
+   
+   /*!
+    @function
+    @abstract   Loads a screen image stored in program memory.
+    @discussion The image is a list of runs of characters already laid out
+    in DDRAM, each written with a single address command. On most displays
+    the rows of a DDRAM line are contiguous, a 20x4 screen is two runs: rows
+    0 and 2 at 0x00, rows 1 and 3 at 0x40.
+    
+    const uint8_t menu[] PROGMEM = {
+       LCD_SCREEN_RUN ( 0x00, 4 ), 'M', 'e', 'n', 'u',
+       LCD_SCREEN_RUN ( 0x40, 3 ), '>', ' ', '1',
+       LCD_SCREEN_END
+    };
+    
+    The cursor is left after the last run.
+    
+    @param      screen[in] image in program memory.
+    */
+   void loadScreen(const uint8_t *screen);
+   
 #if (ARDUINO <  100)
    using Print::write;
 #else
@@ -540,6 +799,27 @@ public:
 #endif   
    
 protected:
+   /*!
+    @function
+    @abstract   Builds the port word of every nibble.
+    @discussion For drivers mapping the LCD data lines onto the outputs of an
+    expander or shift register: map[n] holds the outputs d0..d3 are wired to
+    set as the bits of n, so the data lines are mapped only once.
+    @param      map[out] table of 16 port words (uint8_t or uint16_t).
+    @param      d0..d3[in] outputs of the data lines, lowest bit first.
+    */
+   template <typename T>
+   static void mapNibbles ( T *map, uint8_t d0, uint8_t d1, uint8_t d2, uint8_t d3 )
+   {
+      for ( uint8_t nibble = 0; nibble < 16; nibble++ )
+      {
+         map[nibble] = ( ( nibble & 0x01 ) ? ( (T)1 << d0 ) : 0 ) |
+                       ( ( nibble & 0x02 ) ? ( (T)1 << d1 ) : 0 ) |
+                       ( ( nibble & 0x04 ) ? ( (T)1 << d2 ) : 0 ) |
+                       ( ( nibble & 0x08 ) ? ( (T)1 << d3 ) : 0 );
+      }
+   }
+   
    // Internal LCD variables to control the LCD shared between all derived
    // classes.
    uint8_t _displayfunction;  // LCD_5x10DOTS or LCD_5x8DOTS, LCD_4BITMODE or 
@@ -550,8 +830,57 @@ protected:
    uint8_t _numlines;         // Number of lines of the LCD, initialized with begin()
    uint8_t _cols;             // Number of columns in the LCD
    t_backlightPol _polarity;   // Backlight polarity
+   uint8_t _controllers;      // Number of controllers, 2 on 40x4 displays
+   uint8_t _controller;       // Controllers addressed by send(), LCD_CONTROLLER_x
+   uint8_t _shift;            // Display shift, DDRAM column shown on the left
+   uint8_t _page;             // Page shown, 0 or 1
+   uint8_t _drawOffset;       // DDRAM column of the page setCursor() addresses
+   uint8_t _glyphSet;         // Custom character set in CGRAM, LCD_GLYPHS_x
    
 private:
+   /*!
+    @function
+    @abstract   Sends a command to all the controllers.
+    @discussion Commands that apply to the whole display (entry mode, scroll)
+    go to both controllers of a dual controller display.
+    */
+   void commandAll(uint8_t value);
+   
+   /*!
+    @function
+    @abstract   Sends the display control command.
+    @discussion On dual controller displays only the controller holding the
+    cursor shows the cursor and blink.
+    */
+   void displayControl();
+   
+   /*!
+    @function
+    @abstract   Selects the controller written to.
+    @discussion Moves the cursor and blink to the new controller if shown.
+    */
+   void selectController(uint8_t controller);
+   
+   /*!
+    @function
+    @abstract   Shifts the display to show a DDRAM column on the left.
+    @discussion Takes the shortest way, return home for column 0.
+    */
+   void shiftTo(uint8_t column);
+   
+   /*!
+    @function
+    @abstract   Tells if a page is being drawn.
+    @result     true between beginPage() and flipPage().
+    */
+   bool drawingPage();
+   
+   /*!
+    @function
+    @abstract   Blanks the page drawn and returns the cursor to its origin.
+    */
+   void erasePage();
+   
    /*!
     @function
     @abstract   Send a command to the LCD.
@@ -0,0 +1,212 @@
+// ---------------------------------------------------------------------------
+// Copyright (C) - 2026
+//
+//    This program is free software: you can redistribute it and/or modify
+//    it under the terms of the GNU General Public License as published by
+//    the Free Software Foundation, either version 3 of the License, or
+//    any later version.
+//
+//    This program is distributed in the hope that it will be useful,
+//    but WITHOUT ANY WARRANTY; without even the implied warranty of
+//    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//    GNU General Public License for more details.
+//
+//    You should have received a copy of the GNU General Public License v3.0
+//    along with this program.
+//    If not, see <https://www.gnu.org/licenses/gpl-3.0.en.html>.
+//
+// ---------------------------------------------------------------------------
+//
+// Thread Safe: No
+// Extendable: Yes
+//
+// @file LCDAnimator.cpp
+// This file implements animated custom characters on any LCD.
+//
+// @brief
+// The animator keeps a copy of the CGRAM rows of the animated characters.
+// Frames due are compared with it row by row and the rows that differ are
+// written in runs of consecutive CGRAM addresses with LCD::updateChar().
+//
+// @version API 1.0.0
+//
+// ---------------------------------------------------------------------------
+#include <inttypes.h>
+
+#if (ARDUINO <  100)
+#include <WProgram.h>
+#else
+#include <Arduino.h>
+#endif
+#include "LCDAnimator.h"
+
+// CONSTRUCTORS
+// ---------------------------------------------------------------------------
+LCDAnimator::LCDAnimator ( LCD &lcd )
+{
+   _lcd     = &lcd;
+   _repeat  = 0;
+   _pending = 0;
+
+   for ( uint8_t i = 0; i < ANIMATOR_SLOTS; i++ )
+   {
+      _frames[i]   = NULL;
+      _count[i]    = 0;
+      _frame[i]    = 0;
+      _interval[i] = 0;
+      _last[i]     = 0;
+   }
+   for ( uint8_t i = 0; i < sizeof ( _cgram ); i++ )
+   {
+      _cgram[i] = 0;
+   }
+}
+
+// PUBLIC METHODS
+// ---------------------------------------------------------------------------
+
+//
+// attach
+void LCDAnimator::attach ( uint8_t location, const uint8_t *frames, uint8_t count,
+                           uint16_t interval, uint8_t repeat )
+{
+   location &= 0x07;
+
+   _frames[location]   = frames;
+   _count[location]    = count;
+   _frame[location]    = 0;
+   _interval[location] = interval;
+   _last[location]     = millis ( );
+
+   if ( repeat )
+   {
+      _repeat |= ( 1 << location );
+   }
+   else
+   {
+      _repeat &= ~( 1 << location );
+   }
+   _pending |= ( 1 << location );
+}
+
+//
+// detach
+void LCDAnimator::detach ( uint8_t location )
+{
+   location &= 0x07;
+
+   _count[location] = 0;
+   _pending &= ~( 1 << location );
+}
+
+//
+// setFrame
+void LCDAnimator::setFrame ( uint8_t location, uint8_t frame )
+{
+   location &= 0x07;
+
+   if ( frame < _count[location] )
+   {
+      _frame[location] = frame;
+      _last[location]  = millis ( );
+      _pending |= ( 1 << location );
+   }
+}
+
+//
+// update
+uint8_t LCDAnimator::update ( )
+{
+   unsigned long now = millis ( );
+   uint8_t       dirty[ANIMATOR_SLOTS];
+   uint8_t       known = ( _lcd->getGlyphSet ( ) == LCD_GLYPHS_ANIMATOR );
+   uint8_t       written = 0;
+   uint8_t       index;
+
+   // Advance the animations due
+   // --------------------------------
+   for ( uint8_t i = 0; i < ANIMATOR_SLOTS; i++ )
+   {
+      dirty[i] = 0;
+
+      if ( ( _count[i] == 0 ) || ( _interval[i] == 0 ) ||
+           ( now - _last[i] < _interval[i] ) )
+      {
+         continue;
+      }
+
+      _last[i] = now;
+      if ( _frame[i] + 1 < _count[i] )
+      {
+         _frame[i]++;
+         _pending |= ( 1 << i );
+      }
+      else if ( _repeat & ( 1 << i ) )
+      {
+         _frame[i] = 0;
+         _pending |= ( 1 << i );
+      }
+   }
+
+   // Another glyph set may have replaced the animated characters
+   if ( !known )
+   {
+      for ( uint8_t i = 0; i < ANIMATOR_SLOTS; i++ )
+      {
+         if ( _count[i] != 0 )
+         {
+            _pending |= ( 1 << i );
+         }
+      }
+   }
+
+   // Rows of the new frames that differ from the CGRAM
+   // --------------------------------
+   for ( uint8_t i = 0; i < ANIMATOR_SLOTS; i++ )
+   {
+      const uint8_t *frame;
+
+      if ( !( _pending & ( 1 << i ) ) )
+      {
+         continue;
+      }
+
+      frame = _frames[i] + _frame[i] * 8;
+      for ( uint8_t row = 0; row < 8; row++ )
+      {
+         uint8_t value = pgm_read_byte ( frame + row );
+
+         if ( !known || ( _cgram[i * 8 + row] != value ) )
+         {
+            _cgram[i * 8 + row] = value;
+            dirty[i] |= ( 1 << row );
+         }
+      }
+   }
+   _pending = 0;
+
+   // One write sequence per run of changed rows
+   // --------------------------------
+   index = 0;
+   while ( index < sizeof ( _cgram ) )
+   {
+      uint8_t first = index;
+
+      while ( ( index < sizeof ( _cgram ) ) && ( dirty[index >> 3] & ( 1 << ( index & 0x07 ) ) ) )
+      {
+         index++;
+      }
+      if ( index > first )
+      {
+         _lcd->updateChar ( first >> 3, first & 0x07, &_cgram[first], index - first );
+         written = 1;
+      }
+      index++;
+   }
+
+   if ( written )
+   {
+      _lcd->setGlyphSet ( LCD_GLYPHS_ANIMATOR );
+   }
+   return ( written );
+}
@@ -0,0 +1,124 @@
+// ---------------------------------------------------------------------------
+// Copyright (C) - 2026
+//
+//    This program is free software: you can redistribute it and/or modify
+//    it under the terms of the GNU General Public License as published by
+//    the Free Software Foundation, either version 3 of the License, or
+//    any later version.
+//
+//    This program is distributed in the hope that it will be useful,
+//    but WITHOUT ANY WARRANTY; without even the implied warranty of
+//    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//    GNU General Public License for more details.
+//
+//    You should have received a copy of the GNU General Public License v3.0
+//    along with this program.
+//    If not, see <https://www.gnu.org/licenses/gpl-3.0.en.html>.
+//
+// ---------------------------------------------------------------------------
+//
+// Thread Safe: No
+// Extendable: Yes
+//
+// @file LCDAnimator.h
+// This file implements animated custom characters (spinners, blinking icons,
+// progress sprites) on any LCD.
+//
+// @brief
+// An animation cycles the bitmap of a custom character through a list of
+// frames. The character is written on the display once, every place showing
+// it changes with the CGRAM and the display content (DDRAM) is never
+// rewritten.
+//
+// update(), called from loop(), advances the animations that are due. The
+// frames of all of them go out in a single CGRAM write sequence, limited to
+// the rows that differ from what the CGRAM already holds: a frame identical
+// to the current one costs nothing. Loading other custom characters (even
+// with createChar() on other locations) makes the next update() rewrite the
+// animated characters in full, once.
+//
+// The frames are kept in program memory (PROGMEM), 8 rows per frame:
+//
+//    const uint8_t spinner[] PROGMEM = { ... 4 x 8 rows ... };
+//    animator.attach ( 0, spinner, 4, 150 );
+//    lcd.write ( 0 );
+//
+// @version API 1.0.0
+//
+// ---------------------------------------------------------------------------
+#ifndef _LCDANIMATOR_H_
+#define _LCDANIMATOR_H_
+
+#include <inttypes.h>
+#include "LCD.h"
+
+/*!
+ @defined
+ @abstract   Custom characters of the display.
+ */
+#define ANIMATOR_SLOTS 8
+
+class LCDAnimator
+{
+public:
+   /*!
+    @method
+    @abstract   Class constructor.
+    @param      lcd[in] display showing the animations.
+    */
+   LCDAnimator ( LCD &lcd );
+
+   /*!
+    @function
+    @abstract   Animates a custom character.
+    @discussion The first frame is uploaded by the next update().
+    @param      location[in] custom character (0 to 7).
+    @param      frames[in] bitmaps of the frames in program memory, 8 rows
+    each.
+    @param      count[in] number of frames.
+    @param      interval[in] ms between frames, 0 to change them only with
+    setFrame().
+    @param      repeat[in] 1 to loop, 0 to stop on the last frame.
+    */
+   void attach ( uint8_t location, const uint8_t *frames, uint8_t count,
+                 uint16_t interval, uint8_t repeat = 1 );
+
+   /*!
+    @function
+    @abstract   Stops animating a custom character.
+    @discussion The character keeps the bitmap of its current frame.
+    */
+   void detach ( uint8_t location );
+
+   /*!
+    @function
+    @abstract   Selects the frame of an animation.
+    @discussion Shown by the next update(), a progress sprite can be driven
+    this way.
+    @param      location[in] custom character (0 to 7).
+    @param      frame[in] frame to show.
+    */
+   void setFrame ( uint8_t location, uint8_t frame );
+
+   /*!
+    @function
+    @abstract   Advances the animations due and uploads their frames.
+    @discussion To be called from loop(). As with LCD::createChar(), call
+    setCursor() before writing text again.
+    @result     1 if the CGRAM has been written.
+    */
+   uint8_t update ( );
+
+private:
+   LCD           *_lcd;                         // display showing the animations
+   const uint8_t *_frames[ANIMATOR_SLOTS];      // frames of each character
+   uint8_t        _count[ANIMATOR_SLOTS];       // number of frames, 0 if not animated
+   uint8_t        _frame[ANIMATOR_SLOTS];       // frame selected
+   uint16_t       _interval[ANIMATOR_SLOTS];    // ms between frames
+   unsigned long  _last[ANIMATOR_SLOTS];        // time of the last frame
+   uint8_t        _repeat;                      // looping animations, a bit each
+   uint8_t        _pending;                     // frames to upload, a bit each
+   uint8_t        _cgram[ANIMATOR_SLOTS * 8];   // rows held by the CGRAM
+};
+
+#endif
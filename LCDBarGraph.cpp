@@ -0,0 +1,175 @@
+// ---------------------------------------------------------------------------
+// Copyright (C) - 2026
+//
+//    This program is free software: you can redistribute it and/or modify
+//    it under the terms of the GNU General Public License as published by
+//    the Free Software Foundation, either version 3 of the License, or
+//    any later version.
+//
+//    This program is distributed in the hope that it will be useful,
+//    but WITHOUT ANY WARRANTY; without even the implied warranty of
+//    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//    GNU General Public License for more details.
+//
+//    You should have received a copy of the GNU General Public License v3.0
+//    along with this program.
+//    If not, see <https://www.gnu.org/licenses/gpl-3.0.en.html>.
+//
+// ---------------------------------------------------------------------------
+//
+// Thread Safe: No
+// Extendable: Yes
+//
+// @file LCDBarGraph.cpp
+// This file implements a horizontal bar graph on a row of any LCD.
+//
+// @brief
+// See LCDBarGraph.h.
+//
+// @version API 1.0.0
+//
+// ---------------------------------------------------------------------------
+#include <inttypes.h>
+
+#if (ARDUINO <  100)
+#include <WProgram.h>
+#else
+#include <Arduino.h>
+#endif
+#include "LCDBarGraph.h"
+
+/*!
+ @defined
+ @abstract   Nothing known about the bar shown.
+ */
+#define BARGRAPH_UNKNOWN 0xFFFF
+
+// CONSTRUCTORS
+// ---------------------------------------------------------------------------
+LCDBarGraph::LCDBarGraph ( LCD &lcd, uint8_t col, uint8_t row, uint8_t cells )
+{
+   _lcd    = &lcd;
+   _col    = col;
+   _row    = row;
+   _cells  = cells;
+   _min    = 0;
+   _max    = cells * BARGRAPH_STEPS;
+   _pixels = BARGRAPH_UNKNOWN;
+}
+
+// PUBLIC METHODS
+// ---------------------------------------------------------------------------
+
+//
+// setRange
+void LCDBarGraph::setRange ( int min, int max )
+{
+   _min = min;
+   _max = ( max > min ) ? max : min + 1;
+}
+
+//
+// setValue
+void LCDBarGraph::setValue ( int value )
+{
+   uint16_t width = _cells * BARGRAPH_STEPS;
+   uint16_t pixels;
+   uint8_t  first = _cells;
+   uint8_t  last  = 0;
+
+   if ( value <= _min )
+   {
+      pixels = 0;
+   }
+   else if ( value >= _max )
+   {
+      pixels = width;
+   }
+   else
+   {
+      pixels = ( ( (long)value - _min ) * width ) / ( (long)_max - _min );
+   }
+
+   // Nothing to do unless the value or the glyphs in CGRAM changed
+   if ( ( pixels == _pixels ) && ( _lcd->getGlyphSet ( ) == LCD_GLYPHS_HBAR ) )
+   {
+      return;
+   }
+
+   loadGlyphs ( );
+
+   // Rewrite the run of cells whose fill level changed
+   // --------------------------------
+   for ( uint8_t i = 0; i < _cells; i++ )
+   {
+      if ( ( _pixels == BARGRAPH_UNKNOWN ) || ( cell ( i, _pixels ) != cell ( i, pixels ) ) )
+      {
+         if ( first == _cells )
+         {
+            first = i;
+         }
+         last = i;
+      }
+   }
+
+   if ( first < _cells )
+   {
+      _lcd->setCursor ( _col + first, _row );
+      for ( uint8_t i = first; i <= last; i++ )
+      {
+         _lcd->write ( cell ( i, pixels ) );
+      }
+   }
+   _pixels = pixels;
+}
+
+//
+// invalidate
+void LCDBarGraph::invalidate ( )
+{
+   _pixels = BARGRAPH_UNKNOWN;
+}
+
+// PRIVATE METHODS
+// ---------------------------------------------------------------------------
+
+//
+// loadGlyphs
+void LCDBarGraph::loadGlyphs ( )
+{
+   uint8_t charmap[8];
+
+   if ( _lcd->getGlyphSet ( ) == LCD_GLYPHS_HBAR )
+   {
+      return;
+   }
+
+   // Glyph n has its n + 1 left pixel columns lit, the cursor row is left
+   // blank
+   for ( uint8_t n = 0; n < BARGRAPH_STEPS; n++ )
+   {
+      uint8_t columns = ( 0x1F << ( BARGRAPH_STEPS - 1 - n ) ) & 0x1F;
+
+      for ( uint8_t i = 0; i < 7; i++ )
+      {
+         charmap[i] = columns;
+      }
+      charmap[7] = 0;
+      _lcd->createChar ( n, charmap );
+   }
+   _lcd->setGlyphSet ( LCD_GLYPHS_HBAR );
+}
+
+//
+// cell
+uint8_t LCDBarGraph::cell ( uint8_t index, uint16_t pixels )
+{
+   uint16_t left = index * BARGRAPH_STEPS;
+
+   if ( pixels <= left )
+   {
+      return ( ' ' );
+   }
+   pixels -= left;
+   return ( ( pixels >= BARGRAPH_STEPS ) ? BARGRAPH_STEPS - 1 : pixels - 1 );
+}
@@ -0,0 +1,117 @@
+// ---------------------------------------------------------------------------
+// Copyright (C) - 2026
+//
+//    This program is free software: you can redistribute it and/or modify
+//    it under the terms of the GNU General Public License as published by
+//    the Free Software Foundation, either version 3 of the License, or
+//    any later version.
+//
+//    This program is distributed in the hope that it will be useful,
+//    but WITHOUT ANY WARRANTY; without even the implied warranty of
+//    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//    GNU General Public License for more details.
+//
+//    You should have received a copy of the GNU General Public License v3.0
+//    along with this program.
+//    If not, see <https://www.gnu.org/licenses/gpl-3.0.en.html>.
+//
+// ---------------------------------------------------------------------------
+//
+// Thread Safe: No
+// Extendable: Yes
+//
+// @file LCDBarGraph.h
+// This file implements a horizontal bar graph on a row of any LCD.
+//
+// @brief
+// The bar fills a run of cells with the resolution of a pixel column, 5 steps
+// per cell, using the same glyphs as the bargraph of the performanceLCD
+// example (LCD_GLYPHS_HBAR, locations 0 to 4). The glyphs are shared by all
+// the bars and loaded only when another set has replaced them.
+//
+// A new value rewrites only the cells whose fill level changed, a single
+// cell for small changes, so many bars can be kept up to date.
+//
+// Bars can't be shown together with sparklines, big digits or a canvas: each
+// of them loads its own glyphs over the custom characters and the bars on
+// screen turn into garbage. setValue() loads the bar glyphs back when
+// another set has replaced them, even if the value is unchanged.
+//
+// After clearing the display call invalidate() so the bar is redrawn in full.
+//
+// @version API 1.0.0
+//
+// ---------------------------------------------------------------------------
+#ifndef _LCDBARGRAPH_H_
+#define _LCDBARGRAPH_H_
+
+#include <inttypes.h>
+#include "LCD.h"
+
+/*!
+ @defined
+ @abstract   Pixel columns of a cell.
+ */
+#define BARGRAPH_STEPS 5
+
+class LCDBarGraph
+{
+public:
+   /*!
+    @method
+    @abstract   Class constructor.
+    @discussion The range defaults to 0 .. cells * BARGRAPH_STEPS, one unit
+    per pixel column. Nothing is drawn until setValue().
+    @param      lcd[in] display showing the bar.
+    @param      col[in] column of the left cell.
+    @param      row[in] row of the bar.
+    @param      cells[in] length of the bar in cells.
+    */
+   LCDBarGraph ( LCD &lcd, uint8_t col, uint8_t row, uint8_t cells );
+
+   /*!
+    @function
+    @abstract   Sets the values of an empty and a full bar.
+    @param      min[in] value of an empty bar.
+    @param      max[in] value of a full bar.
+    */
+   void setRange ( int min, int max );
+
+   /*!
+    @function
+    @abstract   Shows a value.
+    @discussion Values out of the range show an empty or full bar.
+    @param      value[in] value to show.
+    */
+   void setValue ( int value );
+
+   /*!
+    @function
+    @abstract   Forgets what the bar shows.
+    @discussion The next setValue() redraws every cell of the bar.
+    */
+   void invalidate ( );
+
+private:
+   /*!
+    @method
+    @abstract   Loads the glyphs of the bar unless already in CGRAM.
+    */
+   void loadGlyphs ( );
+
+   /*!
+    @method
+    @abstract   Character of a cell for a bar length in pixels.
+    */
+   uint8_t cell ( uint8_t index, uint16_t pixels );
+
+   LCD     *_lcd;       // display showing the bar
+   uint8_t  _col;       // column of the left cell
+   uint8_t  _row;       // row of the bar
+   uint8_t  _cells;     // length of the bar in cells
+   int      _min;       // value of an empty bar
+   int      _max;       // value of a full bar
+   uint16_t _pixels;    // length shown in pixels
+};
+
+#endif
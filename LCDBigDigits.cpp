@@ -0,0 +1,340 @@
+// ---------------------------------------------------------------------------
+// Copyright (C) - 2026
+//
+//    This program is free software: you can redistribute it and/or modify
+//    it under the terms of the GNU General Public License as published by
+//    the Free Software Foundation, either version 3 of the License, or
+//    any later version.
+//
+//    This program is distributed in the hope that it will be useful,
+//    but WITHOUT ANY WARRANTY; without even the implied warranty of
+//    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//    GNU General Public License for more details.
+//
+//    You should have received a copy of the GNU General Public License v3.0
+//    along with this program.
+//    If not, see <https://www.gnu.org/licenses/gpl-3.0.en.html>.
+//
+// ---------------------------------------------------------------------------
+//
+// Thread Safe: No
+// Extendable: Yes
+//
+// @file LCDBigDigits.cpp
+// This file implements large numerals spanning several rows of any LCD.
+//
+// @brief
+// The segment styles draw the digits of a 7 segment display. Every cell
+// holds at most a top bar, a centred vertical bar and a bottom bar, the 7
+// combinations are the 7 glyphs of the set (LCD_GLYPHS_BIGDIGIT). The
+// rounded style uses a classic set of 8 glyphs (LCD_GLYPHS_BIGDIGIT_RND).
+//
+// @version API 1.0.0
+//
+// ---------------------------------------------------------------------------
+#include <inttypes.h>
+
+#if (ARDUINO <  100)
+#include <WProgram.h>
+#else
+#include <Arduino.h>
+#endif
+#include "LCDBigDigits.h"
+
+/*!
+ @defined
+ @abstract   Nothing known about the digit shown.
+ */
+#define BIGDIGIT_UNKNOWN 0xFF
+
+// Segments of a 7 segment digit
+// ---------------------------------------------------------------------------
+#define SEG_A            0x01   // top
+#define SEG_B            0x02   // upper right
+#define SEG_C            0x04   // lower right
+#define SEG_D            0x08   // bottom
+#define SEG_E            0x10   // lower left
+#define SEG_F            0x20   // upper left
+#define SEG_G            0x40   // middle
+
+// Contents of a cell of the segment styles, the glyph is at location code - 1
+// ---------------------------------------------------------------------------
+#define CELL_TOP         0x01   // bar on the top rows
+#define CELL_VERTICAL    0x02   // vertical bar
+#define CELL_BOTTOM      0x04   // bar on the bottom rows
+
+// Segments of 0 to 9, blank and minus
+static const uint8_t bigSegments[BIGDIGIT_MINUS + 1] PROGMEM =
+{
+   0x3F, 0x06, 0x5B, 0x4F, 0x66, 0x6D, 0x7D, 0x07, 0x7F, 0x6F, 0x00, 0x40
+};
+
+// Segment style glyphs, indexed by cell code - 1
+static const uint8_t bigSegmentGlyphs[7][8] PROGMEM =
+{
+   { 0x1F, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },   // top
+   { 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E },   // vertical
+   { 0x1F, 0x1F, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E },   // top, vertical
+   { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x1F },   // bottom
+   { 0x1F, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x1F },   // top, bottom
+   { 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x1F, 0x1F },   // vertical, bottom
+   { 0x1F, 0x1F, 0x0E, 0x0E, 0x0E, 0x0E, 0x1F, 0x1F }    // all
+};
+
+// Rounded style glyphs
+static const uint8_t bigRoundGlyphs[8][8] PROGMEM =
+{
+   { 0x07, 0x0F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F },   // 0 upper left
+   { 0x1F, 0x1F, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00 },   // 1 upper bar
+   { 0x1C, 0x1E, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F },   // 2 upper right
+   { 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x0F, 0x07 },   // 3 lower left
+   { 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x1F, 0x1F },   // 4 lower bar
+   { 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1E, 0x1C },   // 5 lower right
+   { 0x1F, 0x1F, 0x1F, 0x00, 0x00, 0x00, 0x1F, 0x1F },   // 6 upper and middle
+   { 0x1F, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x1F, 0x1F }    // 7 middle and lower
+};
+
+// Rounded style digits, top row then bottom row
+static const uint8_t bigRound[BIGDIGIT_MINUS + 1][6] PROGMEM =
+{
+   { 0x00, 0x01, 0x02, 0x03, 0x04, 0x05 },   // 0
+   { 0x01, 0x02, 0x20, 0x04, 0xFF, 0x04 },   // 1
+   { 0x06, 0x06, 0x02, 0x03, 0x07, 0x07 },   // 2
+   { 0x06, 0x06, 0x02, 0x07, 0x07, 0x05 },   // 3
+   { 0x03, 0x04, 0xFF, 0x20, 0x20, 0xFF },   // 4
+   { 0xFF, 0x06, 0x06, 0x07, 0x07, 0x05 },   // 5
+   { 0x00, 0x06, 0x06, 0x03, 0x07, 0x05 },   // 6
+   { 0x01, 0x01, 0x02, 0x20, 0x20, 0xFF },   // 7
+   { 0x00, 0x06, 0x02, 0x03, 0x07, 0x05 },   // 8
+   { 0x00, 0x06, 0x02, 0x20, 0x20, 0xFF },   // 9
+   { 0x20, 0x20, 0x20, 0x20, 0x20, 0x20 },   // blank
+   { 0x04, 0x04, 0x04, 0x20, 0x20, 0x20 }    // minus
+};
+
+// CONSTRUCTORS
+// ---------------------------------------------------------------------------
+LCDBigDigits::LCDBigDigits ( LCD &lcd, uint8_t col, uint8_t row, uint8_t digits,
+                             uint8_t style )
+{
+   _lcd    = &lcd;
+   _col    = col;
+   _row    = row;
+   _digits = ( digits == 0 ) ? 1 : ( ( digits > BIGDIGIT_MAX ) ? BIGDIGIT_MAX : digits );
+   _style  = style;
+   _width  = ( style == BIGDIGIT_3X2 ) ? 3 : 2;
+   _height = ( style == BIGDIGIT_2X4 ) ? 4 : 2;
+
+   invalidate ( );
+}
+
+// PUBLIC METHODS
+// ---------------------------------------------------------------------------
+
+//
+// print
+void LCDBigDigits::print ( long value )
+{
+   uint8_t       digit[BIGDIGIT_MAX];
+   unsigned long n = ( value < 0 ) ? 0UL - (unsigned long)value : value;
+   uint8_t       pos = _digits;
+
+   do
+   {
+      digit[--pos] = n % 10;
+      n /= 10;
+   } while ( ( n != 0 ) && ( pos > 0 ) );
+
+   if ( value < 0 )
+   {
+      if ( pos > 0 )
+      {
+         digit[--pos] = BIGDIGIT_MINUS;
+      }
+      else
+      {
+         n = 1;                   // no room left for the sign
+      }
+   }
+
+   // Leading blanks, or all minus signs if the number doesn't fit
+   // --------------------------------
+   while ( pos > 0 )
+   {
+      digit[--pos] = BIGDIGIT_BLANK;
+   }
+   for ( pos = 0; pos < _digits; pos++ )
+   {
+      printDigit ( pos, ( n != 0 ) ? BIGDIGIT_MINUS : digit[pos] );
+   }
+}
+
+//
+// printDigit
+void LCDBigDigits::printDigit ( uint8_t pos, uint8_t digit )
+{
+   uint8_t shown;
+   uint8_t columns;
+
+   if ( ( pos >= _digits ) || ( digit > BIGDIGIT_MINUS ) )
+   {
+      return;
+   }
+
+   loadGlyphs ( );
+
+   shown = _shown[pos];
+   if ( shown == digit )
+   {
+      return;
+   }
+
+   // The blank column after the digit is compared too, it is only written
+   // when the field is redrawn in full
+   columns = ( pos + 1 < _digits ) ? _width + 1 : _width;
+
+   // Rewrite the run of characters that differ in each row
+   // --------------------------------
+   for ( uint8_t y = 0; y < _height; y++ )
+   {
+      uint8_t first = columns;
+      uint8_t last  = 0;
+
+      for ( uint8_t x = 0; x < columns; x++ )
+      {
+         if ( ( shown == BIGDIGIT_UNKNOWN ) || ( cell ( shown, x, y ) != cell ( digit, x, y ) ) )
+         {
+            if ( first == columns )
+            {
+               first = x;
+            }
+            last = x;
+         }
+      }
+
+      if ( first < columns )
+      {
+         _lcd->setCursor ( _col + pos * ( _width + 1 ) + first, _row + y );
+         for ( uint8_t x = first; x <= last; x++ )
+         {
+            _lcd->write ( cell ( digit, x, y ) );
+         }
+      }
+   }
+   _shown[pos] = digit;
+}
+
+//
+// invalidate
+void LCDBigDigits::invalidate ( )
+{
+   for ( uint8_t i = 0; i < BIGDIGIT_MAX; i++ )
+   {
+      _shown[i] = BIGDIGIT_UNKNOWN;
+   }
+}
+
+// PRIVATE METHODS
+// ---------------------------------------------------------------------------
+
+//
+// loadGlyphs
+void LCDBigDigits::loadGlyphs ( )
+{
+   uint8_t        set;
+   uint8_t        count;
+   const uint8_t *glyphs;
+   uint8_t        charmap[8];
+
+   if ( _style == BIGDIGIT_3X2 )
+   {
+      set    = LCD_GLYPHS_BIGDIGIT_RND;
+      count  = 8;
+      glyphs = &bigRoundGlyphs[0][0];
+   }
+   else
+   {
+      set    = LCD_GLYPHS_BIGDIGIT;
+      count  = 7;
+      glyphs = &bigSegmentGlyphs[0][0];
+   }
+
+   if ( _lcd->getGlyphSet ( ) == set )
+   {
+      return;
+   }
+
+   for ( uint8_t location = 0; location < count; location++ )
+   {
+      for ( uint8_t i = 0; i < 8; i++ )
+      {
+         charmap[i] = pgm_read_byte ( glyphs++ );
+      }
+      _lcd->createChar ( location, charmap );
+   }
+   _lcd->setGlyphSet ( set );
+}
+
+//
+// cell
+uint8_t LCDBigDigits::cell ( uint8_t digit, uint8_t x, uint8_t y )
+{
+   uint8_t segments;
+   uint8_t upper;
+   uint8_t lower;
+   uint8_t code;
+
+   if ( x >= _width )
+   {
+      return ( ' ' );
+   }
+
+   if ( _style == BIGDIGIT_3X2 )
+   {
+      return ( pgm_read_byte ( &bigRound[digit][y * 3 + x] ) );
+   }
+
+   // Vertical segments of the left or right column of the digit
+   // --------------------------------
+   segments = pgm_read_byte ( &bigSegments[digit] );
+   upper    = segments & ( ( x == 0 ) ? SEG_F : SEG_B );
+   lower    = segments & ( ( x == 0 ) ? SEG_E : SEG_C );
+
+   if ( _style == BIGDIGIT_2X2 )
+   {
+      // The middle segment is the bottom bar of the upper cell
+      if ( y == 0 )
+      {
+         code = ( ( segments & SEG_A ) ? CELL_TOP : 0 ) |
+                ( upper ? CELL_VERTICAL : 0 ) |
+                ( ( segments & SEG_G ) ? CELL_BOTTOM : 0 );
+      }
+      else
+      {
+         code = ( lower ? CELL_VERTICAL : 0 ) |
+                ( ( segments & SEG_D ) ? CELL_BOTTOM : 0 );
+      }
+   }
+   else
+   {
+      // Each vertical segment spans two rows
+      switch ( y )
+      {
+         case 0:
+            code = ( ( segments & SEG_A ) ? CELL_TOP : 0 ) |
+                   ( upper ? CELL_VERTICAL : 0 );
+            break;
+         case 1:
+            code = ( upper ? CELL_VERTICAL : 0 ) |
+                   ( ( segments & SEG_G ) ? CELL_BOTTOM : 0 );
+            break;
+         case 2:
+            code = ( lower ? CELL_VERTICAL : 0 );
+            break;
+         default:
+            code = ( lower ? CELL_VERTICAL : 0 ) |
+                   ( ( segments & SEG_D ) ? CELL_BOTTOM : 0 );
+            break;
+      }
+   }
+   return ( ( code != 0 ) ? code - 1 : ' ' );
+}
@@ -0,0 +1,138 @@
+// ---------------------------------------------------------------------------
+// Copyright (C) - 2026
+//
+//    This program is free software: you can redistribute it and/or modify
+//    it under the terms of the GNU General Public License as published by
+//    the Free Software Foundation, either version 3 of the License, or
+//    any later version.
+//
+//    This program is distributed in the hope that it will be useful,
+//    but WITHOUT ANY WARRANTY; without even the implied warranty of
+//    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//    GNU General Public License for more details.
+//
+//    You should have received a copy of the GNU General Public License v3.0
+//    along with this program.
+//    If not, see <https://www.gnu.org/licenses/gpl-3.0.en.html>.
+//
+// ---------------------------------------------------------------------------
+//
+// Thread Safe: No
+// Extendable: Yes
+//
+// @file LCDBigDigits.h
+// This file implements large numerals spanning several rows of any LCD.
+//
+// @brief
+// A field shows a number with big digits built from custom characters:
+//
+//    BIGDIGIT_2X2  2 columns x 2 rows, segment style
+//    BIGDIGIT_3X2  3 columns x 2 rows, rounded style
+//    BIGDIGIT_2X4  2 columns x 4 rows, segment style
+//
+// The glyphs are loaded in CGRAM by the first field drawn and only reloaded
+// when another set has replaced them (LCD::getGlyphSet()), fields of the same
+// style share them. Fields of different styles, bars, sparklines or a canvas
+// can't be shown at the same time, each loading its own glyphs over the
+// others; the next print() of a field loads its glyphs back. Each field remembers what it shows and a new value only
+// rewrites the characters that differ, a digit that doesn't change costs
+// nothing.
+//
+// Digits are separated by a blank column. After clearing the display, or
+// drawing over a field, call invalidate() so the field is redrawn in full.
+//
+// @version API 1.0.0
+//
+// ---------------------------------------------------------------------------
+#ifndef _LCDBIGDIGITS_H_
+#define _LCDBIGDIGITS_H_
+
+#include <inttypes.h>
+#include "LCD.h"
+
+/*!
+ @defined
+ @abstract   Digit styles.
+ */
+#define BIGDIGIT_2X2     0
+#define BIGDIGIT_3X2     1
+#define BIGDIGIT_2X4     2
+
+/*!
+ @defined
+ @abstract   Symbols that can be shown besides the digits 0 to 9.
+ */
+#define BIGDIGIT_BLANK   10
+#define BIGDIGIT_MINUS   11
+
+/*!
+ @defined
+ @abstract   Maximum number of digits of a field.
+ */
+#define BIGDIGIT_MAX     8
+
+class LCDBigDigits
+{
+public:
+   /*!
+    @method
+    @abstract   Class constructor.
+    @discussion Nothing is drawn until print().
+    @param      lcd[in] display showing the field.
+    @param      col[in] column of the left digit.
+    @param      row[in] top row of the digits.
+    @param      digits[in] number of digits of the field (1..BIGDIGIT_MAX).
+    @param      style[in] BIGDIGIT_2X2, BIGDIGIT_3X2 or BIGDIGIT_2X4.
+    */
+   LCDBigDigits ( LCD &lcd, uint8_t col, uint8_t row, uint8_t digits,
+                  uint8_t style = BIGDIGIT_3X2 );
+
+   /*!
+    @function
+    @abstract   Shows a number.
+    @discussion Right aligned, with leading blanks and a minus sign for
+    negative values. Numbers that don't fit show all minus signs.
+    @param      value[in] number to show.
+    */
+   void print ( long value );
+
+   /*!
+    @function
+    @abstract   Shows a single digit.
+    @param      pos[in] digit of the field, 0 is the left one.
+    @param      digit[in] 0 to 9, BIGDIGIT_BLANK or BIGDIGIT_MINUS.
+    */
+   void printDigit ( uint8_t pos, uint8_t digit );
+
+   /*!
+    @function
+    @abstract   Forgets what the field shows.
+    @discussion The next print() redraws every digit of the field.
+    */
+   void invalidate ( );
+
+private:
+   /*!
+    @method
+    @abstract   Loads the glyphs of the style unless already in CGRAM.
+    */
+   void loadGlyphs ( );
+
+   /*!
+    @method
+    @abstract   Character of a digit at a column and row of the digit.
+    @discussion Column _width is the blank column after the digit.
+    */
+   uint8_t cell ( uint8_t digit, uint8_t x, uint8_t y );
+
+   LCD     *_lcd;                   // display showing the field
+   uint8_t  _col;                   // column of the left digit
+   uint8_t  _row;                   // top row of the digits
+   uint8_t  _digits;                // digits of the field
+   uint8_t  _style;                 // BIGDIGIT_x style
+   uint8_t  _width;                 // columns of a digit
+   uint8_t  _height;                // rows of a digit
+   uint8_t  _shown[BIGDIGIT_MAX];   // digit shown at each position
+};
+
+#endif
@@ -0,0 +1,239 @@
+// ---------------------------------------------------------------------------
+// Copyright (C) - 2026
+//
+//    This program is free software: you can redistribute it and/or modify
+//    it under the terms of the GNU General Public License as published by
+//    the Free Software Foundation, either version 3 of the License, or
+//    any later version.
+//
+//    This program is distributed in the hope that it will be useful,
+//    but WITHOUT ANY WARRANTY; without even the implied warranty of
+//    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//    GNU General Public License for more details.
+//
+//    You should have received a copy of the GNU General Public License v3.0
+//    along with this program.
+//    If not, see <https://www.gnu.org/licenses/gpl-3.0.en.html>.
+//
+// ---------------------------------------------------------------------------
+//
+// Thread Safe: No
+// Extendable: Yes
+//
+// @file LCDCanvas.cpp
+// This file implements a small bitmap canvas drawn with the custom
+// characters of any LCD.
+//
+// @brief
+// Cell (c, r) of the canvas is custom character r * cols + c. The copy of
+// the CGRAM is laid out as the CGRAM itself, 8 rows per character, so a run
+// of changed rows maps to a run of CGRAM addresses, even across characters.
+//
+// @version API 1.0.0
+//
+// ---------------------------------------------------------------------------
+#include <stdlib.h>
+#include <inttypes.h>
+
+#if (ARDUINO <  100)
+#include <WProgram.h>
+#else
+#include <Arduino.h>
+#endif
+#include "LCDCanvas.h"
+
+// CONSTRUCTORS
+// ---------------------------------------------------------------------------
+LCDCanvas::LCDCanvas ( LCD &lcd, uint8_t cols, uint8_t rows )
+{
+   _lcd  = &lcd;
+   _rows = ( rows == 0 ) ? 1 : ( ( rows > CANVAS_GLYPHS ) ? CANVAS_GLYPHS : rows );
+   _cols = ( cols == 0 ) ? 1 : cols;
+   if ( _cols * _rows > CANVAS_GLYPHS )
+   {
+      _cols = CANVAS_GLYPHS / _rows;
+   }
+
+   for ( uint8_t i = 0; i < sizeof ( _cgram ); i++ )
+   {
+      _cgram[i] = 0;
+   }
+   for ( uint8_t i = 0; i < CANVAS_GLYPHS; i++ )
+   {
+      _dirty[i] = 0xFF;
+   }
+}
+
+// PUBLIC METHODS
+// ---------------------------------------------------------------------------
+
+//
+// place
+void LCDCanvas::place ( uint8_t col, uint8_t row )
+{
+   for ( uint8_t r = 0; r < _rows; r++ )
+   {
+      _lcd->setCursor ( col, row + r );
+      for ( uint8_t c = 0; c < _cols; c++ )
+      {
+         _lcd->write ( r * _cols + c );
+      }
+   }
+}
+
+//
+// clear
+void LCDCanvas::clear ( )
+{
+   for ( uint8_t i = 0; i < sizeof ( _cgram ); i++ )
+   {
+      if ( _cgram[i] != 0 )
+      {
+         _cgram[i] = 0;
+         _dirty[i >> 3] |= ( 1 << ( i & 0x07 ) );
+      }
+   }
+}
+
+//
+// setPixel
+void LCDCanvas::setPixel ( uint8_t x, uint8_t y, uint8_t on )
+{
+   uint8_t index;
+   uint8_t mask;
+   uint8_t value;
+
+   if ( ( x >= width ( ) ) || ( y >= height ( ) ) )
+   {
+      return;
+   }
+
+   index = ( ( y / CANVAS_CELL_HEIGHT ) * _cols + ( x / CANVAS_CELL_WIDTH ) ) *
+           CANVAS_CELL_HEIGHT + ( y % CANVAS_CELL_HEIGHT );
+   mask  = 0x10 >> ( x % CANVAS_CELL_WIDTH );
+   value = on ? ( _cgram[index] | mask ) : ( _cgram[index] & ~mask );
+
+   // Only real changes mark the row
+   if ( value != _cgram[index] )
+   {
+      _cgram[index] = value;
+      _dirty[index >> 3] |= ( 1 << ( index & 0x07 ) );
+   }
+}
+
+//
+// getPixel
+uint8_t LCDCanvas::getPixel ( uint8_t x, uint8_t y )
+{
+   uint8_t index;
+
+   if ( ( x >= width ( ) ) || ( y >= height ( ) ) )
+   {
+      return ( 0 );
+   }
+
+   index = ( ( y / CANVAS_CELL_HEIGHT ) * _cols + ( x / CANVAS_CELL_WIDTH ) ) *
+           CANVAS_CELL_HEIGHT + ( y % CANVAS_CELL_HEIGHT );
+   return ( ( _cgram[index] & ( 0x10 >> ( x % CANVAS_CELL_WIDTH ) ) ) ? 1 : 0 );
+}
+
+//
+// line
+void LCDCanvas::line ( uint8_t x0, uint8_t y0, uint8_t x1, uint8_t y1, uint8_t on )
+{
+   // Bresenham, integer steps only
+   int dx  = abs ( (int)x1 - x0 );
+   int dy  = -abs ( (int)y1 - y0 );
+   int sx  = ( x0 < x1 ) ? 1 : -1;
+   int sy  = ( y0 < y1 ) ? 1 : -1;
+   int err = dx + dy;
+   int x   = x0;
+   int y   = y0;
+
+   for ( ;; )
+   {
+      int e2 = 2 * err;
+
+      setPixel ( x, y, on );
+      if ( ( x == x1 ) && ( y == y1 ) )
+      {
+         break;
+      }
+      if ( e2 >= dy )
+      {
+         err += dy;
+         x   += sx;
+      }
+      if ( e2 <= dx )
+      {
+         err += dx;
+         y   += sy;
+      }
+   }
+}
+
+//
+// fill
+void LCDCanvas::fill ( uint8_t x, uint8_t y, uint8_t w, uint8_t h, uint8_t on )
+{
+   // Clip to the canvas, x + i must not wrap around to low coordinates
+   if ( ( x >= width ( ) ) || ( y >= height ( ) ) )
+   {
+      return;
+   }
+   if ( w > width ( ) - x )
+   {
+      w = width ( ) - x;
+   }
+   if ( h > height ( ) - y )
+   {
+      h = height ( ) - y;
+   }
+
+   for ( uint8_t j = 0; j < h; j++ )
+   {
+      for ( uint8_t i = 0; i < w; i++ )
+      {
+         setPixel ( x + i, y + j, on );
+      }
+   }
+}
+
+//
+// flush
+void LCDCanvas::flush ( )
+{
+   uint8_t used  = _cols * _rows * CANVAS_CELL_HEIGHT;
+   uint8_t index = 0;
+
+   if ( _lcd->getGlyphSet ( ) != LCD_GLYPHS_CANVAS )
+   {
+      for ( uint8_t i = 0; i < CANVAS_GLYPHS; i++ )
+      {
+         _dirty[i] = 0xFF;
+      }
+   }
+
+   // One write sequence per run of changed rows
+   // --------------------------------
+   while ( index < used )
+   {
+      uint8_t first = index;
+
+      while ( ( index < used ) && ( _dirty[index >> 3] & ( 1 << ( index & 0x07 ) ) ) )
+      {
+         index++;
+      }
+      if ( index > first )
+      {
+         _lcd->updateChar ( first >> 3, first & 0x07, &_cgram[first], index - first );
+      }
+      index++;
+   }
+
+   for ( uint8_t i = 0; i < CANVAS_GLYPHS; i++ )
+   {
+      _dirty[i] = 0;
+   }
+   _lcd->setGlyphSet ( LCD_GLYPHS_CANVAS );
+}
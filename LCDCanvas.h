@@ -0,0 +1,155 @@
+// ---------------------------------------------------------------------------
+// Copyright (C) - 2026
+//
+//    This program is free software: you can redistribute it and/or modify
+//    it under the terms of the GNU General Public License as published by
+//    the Free Software Foundation, either version 3 of the License, or
+//    any later version.
+//
+//    This program is distributed in the hope that it will be useful,
+//    but WITHOUT ANY WARRANTY; without even the implied warranty of
+//    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//    GNU General Public License for more details.
+//
+//    You should have received a copy of the GNU General Public License v3.0
+//    along with this program.
+//    If not, see <https://www.gnu.org/licenses/gpl-3.0.en.html>.
+//
+// ---------------------------------------------------------------------------
+//
+// Thread Safe: No
+// Extendable: Yes
+//
+// @file LCDCanvas.h
+// This file implements a small bitmap canvas drawn with the custom
+// characters of any LCD.
+//
+// @brief
+// The canvas is a block of cells, up to the 8 custom characters of the
+// display: 4x2 cells give 20x16 pixels, 8x1 cells 40x8 pixels. Drawing only
+// changes a copy of the CGRAM kept by the canvas, flush() then uploads the
+// pixel rows that changed since the last flush, grouping consecutive rows in
+// a single write sequence.
+//
+// place() writes the characters of the canvas on the display once, the
+// display then follows the CGRAM content by itself. The canvas owns all the
+// custom characters, other components using them can't be shown at the same
+// time. flush() uploads the whole canvas again when another set has replaced
+// it.
+//
+// @version API 1.0.0
+//
+// ---------------------------------------------------------------------------
+#ifndef _LCDCANVAS_H_
+#define _LCDCANVAS_H_
+
+#include <inttypes.h>
+#include "LCD.h"
+
+/*!
+ @defined
+ @abstract   Pixel size of a cell.
+ */
+#define CANVAS_CELL_WIDTH  5
+#define CANVAS_CELL_HEIGHT 8
+
+/*!
+ @defined
+ @abstract   Custom characters of the display.
+ */
+#define CANVAS_GLYPHS      8
+
+class LCDCanvas
+{
+public:
+   /*!
+    @method
+    @abstract   Class constructor.
+    @discussion The canvas starts blank. cols * rows is limited to
+    CANVAS_GLYPHS, rows first.
+    @param      lcd[in] display showing the canvas.
+    @param      cols[in] width of the canvas in cells.
+    @param      rows[in] height of the canvas in cells.
+    */
+   LCDCanvas ( LCD &lcd, uint8_t cols = 4, uint8_t rows = 2 );
+
+   /*!
+    @function
+    @abstract   Width of the canvas in pixels.
+    */
+   uint8_t width ( ) { return _cols * CANVAS_CELL_WIDTH; }
+
+   /*!
+    @function
+    @abstract   Height of the canvas in pixels.
+    */
+   uint8_t height ( ) { return _rows * CANVAS_CELL_HEIGHT; }
+
+   /*!
+    @function
+    @abstract   Writes the characters of the canvas on the display.
+    @discussion Needed once, and again after clearing the display.
+    @param      col[in] column of the left cells.
+    @param      row[in] row of the top cells.
+    */
+   void place ( uint8_t col, uint8_t row );
+
+   /*!
+    @function
+    @abstract   Clears all the pixels.
+    */
+   void clear ( );
+
+   /*!
+    @function
+    @abstract   Sets or clears a pixel.
+    @discussion Pixels out of the canvas are ignored.
+    @param      x[in] column, 0 is the left one.
+    @param      y[in] row, 0 is the top one.
+    @param      on[in] 1 to set the pixel, 0 to clear it.
+    */
+   void setPixel ( uint8_t x, uint8_t y, uint8_t on = 1 );
+
+   /*!
+    @function
+    @abstract   State of a pixel.
+    @result     1 if the pixel is set, 0 if clear or out of the canvas.
+    */
+   uint8_t getPixel ( uint8_t x, uint8_t y );
+
+   /*!
+    @function
+    @abstract   Draws a line between two pixels, both included.
+    */
+   void line ( uint8_t x0, uint8_t y0, uint8_t x1, uint8_t y1, uint8_t on = 1 );
+
+   /*!
+    @function
+    @abstract   Sets or clears a rectangle of pixels.
+    @discussion The rectangle is clipped to the canvas.
+    @param      x[in] left column.
+    @param      y[in] top row.
+    @param      w[in] width in pixels.
+    @param      h[in] height in pixels.
+    @param      on[in] 1 to set the pixels, 0 to clear them.
+    */
+   void fill ( uint8_t x, uint8_t y, uint8_t w, uint8_t h, uint8_t on = 1 );
+
+   /*!
+    @function
+    @abstract   Uploads the pixel rows changed since the last flush.
+    @discussion Everything is uploaded if another component has replaced
+    the custom characters. As with LCD::createChar(), call setCursor() before
+    writing text again.
+    */
+   void flush ( );
+
+private:
+   LCD     *_lcd;                                        // display showing the canvas
+   uint8_t  _cols;                                       // width in cells
+   uint8_t  _rows;                                       // height in cells
+   uint8_t  _cgram[CANVAS_GLYPHS * CANVAS_CELL_HEIGHT];  // pixel rows of the glyphs
+   uint8_t  _dirty[CANVAS_GLYPHS];                       // rows changed, a bit per row
+};
+
+#endif
@@ -0,0 +1,161 @@
+// ---------------------------------------------------------------------------
+// Copyright (C) - 2026
+//
+//    This program is free software: you can redistribute it and/or modify
+//    it under the terms of the GNU General Public License as published by
+//    the Free Software Foundation, either version 3 of the License, or
+//    any later version.
+//
+//    This program is distributed in the hope that it will be useful,
+//    but WITHOUT ANY WARRANTY; without even the implied warranty of
+//    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//    GNU General Public License for more details.
+//
+//    You should have received a copy of the GNU General Public License v3.0
+//    along with this program.
+//    If not, see <https://www.gnu.org/licenses/gpl-3.0.en.html>.
+//
+// ---------------------------------------------------------------------------
+//
+// Thread Safe: No
+// Extendable: Yes
+//
+// @file LCDField.cpp
+// This file implements fixed width fields updated in place on any LCD.
+//
+// @brief
+// The field keeps a copy of the characters displayed. The changed characters
+// are written in runs with a single LCD::write() call each; a run carries on
+// over one unchanged character, which costs as much as the setCursor() to
+// skip it.
+//
+// @version API 1.0.0
+//
+// ---------------------------------------------------------------------------
+#include <string.h>
+#include <inttypes.h>
+
+#if (ARDUINO <  100)
+#include <WProgram.h>
+#else
+#include <Arduino.h>
+#endif
+#include "LCDField.h"
+
+// CONSTRUCTORS
+// ---------------------------------------------------------------------------
+LCDField::LCDField ( LCD &lcd, uint8_t col, uint8_t row, uint8_t width,
+                     uint8_t align )
+{
+   _lcd   = &lcd;
+   _col   = col;
+   _row   = row;
+   _width = ( width > LCD_FIELD_MAX ) ? LCD_FIELD_MAX : width;
+   _align = align;
+   _valid = 0;
+}
+
+// PUBLIC METHODS
+// ---------------------------------------------------------------------------
+
+//
+// set
+void LCDField::set ( const char *text )
+{
+   uint8_t length = 0;
+
+   while ( ( length < _width ) && ( text[length] != '\0' ) )
+   {
+      length++;
+   }
+   draw ( text, length );
+}
+
+//
+// set
+void LCDField::set ( long value, uint8_t decimals )
+{
+   char    buffer[LCD_FIELD_MAX];
+   uint8_t skip = 0;
+
+   LCD::formatFixed ( buffer, value, decimals, _width );
+
+   // Strip the padding, draw() aligns the number
+   while ( ( skip < _width - 1 ) && ( buffer[skip] == ' ' ) )
+   {
+      skip++;
+   }
+   draw ( buffer + skip, _width - skip );
+}
+
+//
+// invalidate
+void LCDField::invalidate ( )
+{
+   _valid = 0;
+}
+
+// PRIVATE METHODS
+// ---------------------------------------------------------------------------
+
+//
+// draw
+void LCDField::draw ( const char *text, uint8_t length )
+{
+   char    field[LCD_FIELD_MAX];
+   uint8_t left;
+   uint8_t index;
+
+   // Lay the text out in the field
+   // --------------------------------
+   switch ( _align )
+   {
+      case FIELD_ALIGN_RIGHT:
+         left = _width - length;
+         break;
+      case FIELD_ALIGN_CENTER:
+         left = ( _width - length ) >> 1;
+         break;
+      default:
+         left = 0;
+         break;
+   }
+   memset ( field, ' ', _width );
+   memcpy ( field + left, text, length );
+
+   // Write the runs of changed characters
+   // --------------------------------
+   index = 0;
+   while ( index < _width )
+   {
+      uint8_t first;
+      uint8_t last;
+
+      if ( _valid && ( field[index] == _shadow[index] ) )
+      {
+         index++;
+         continue;
+      }
+
+      first = index;
+      last  = index;
+      while ( ++index < _width )
+      {
+         if ( !_valid || ( field[index] != _shadow[index] ) )
+         {
+            last = index;
+         }
+         else if ( ( index + 1 >= _width ) || ( field[index + 1] == _shadow[index + 1] ) )
+         {
+            break;
+         }
+      }
+
+      _lcd->setCursor ( _col + first, _row );
+      _lcd->write ( (const uint8_t *)field + first, last - first + 1 );
+      index = last + 1;
+   }
+
+   memcpy ( _shadow, field, _width );
+   _valid = 1;
+}
@@ -0,0 +1,114 @@
+// ---------------------------------------------------------------------------
+// Copyright (C) - 2026
+//
+//    This program is free software: you can redistribute it and/or modify
+//    it under the terms of the GNU General Public License as published by
+//    the Free Software Foundation, either version 3 of the License, or
+//    any later version.
+//
+//    This program is distributed in the hope that it will be useful,
+//    but WITHOUT ANY WARRANTY; without even the implied warranty of
+//    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//    GNU General Public License for more details.
+//
+//    You should have received a copy of the GNU General Public License v3.0
+//    along with this program.
+//    If not, see <https://www.gnu.org/licenses/gpl-3.0.en.html>.
+//
+// ---------------------------------------------------------------------------
+//
+// Thread Safe: No
+// Extendable: Yes
+//
+// @file LCDField.h
+// This file implements fixed width fields updated in place on any LCD.
+//
+// @brief
+// A field is a region of a row with a width and an alignment. set() lays the
+// text or number out in the field, padding with spaces, and compares it with
+// what the field shows: only the characters that changed are written, so
+// updating a value needs neither clearing the field nor printing spaces.
+//
+//    LCDField temperature ( lcd, 10, 0, 6, FIELD_ALIGN_RIGHT );
+//    temperature.set ( 215, 1 );           // "  21.5"
+//    temperature.set ( 216, 1 );           // writes the '6' only
+//
+// After clearing the display call invalidate() so the field is redrawn in
+// full. set() moves the cursor of the display.
+//
+// @version API 1.0.0
+//
+// ---------------------------------------------------------------------------
+#ifndef _LCDFIELD_H_
+#define _LCDFIELD_H_
+
+#include <inttypes.h>
+#include "LCD.h"
+
+/*!
+ @defined
+ @abstract   Alignment of the content of a field.
+ */
+#define FIELD_ALIGN_LEFT   0
+#define FIELD_ALIGN_RIGHT  1
+#define FIELD_ALIGN_CENTER 2
+
+class LCDField
+{
+public:
+   /*!
+    @method
+    @abstract   Class constructor.
+    @discussion Nothing is drawn until set().
+    @param      lcd[in] display showing the field.
+    @param      col[in] column of the left character.
+    @param      row[in] row of the field.
+    @param      width[in] characters of the field (1..LCD_FIELD_MAX).
+    @param      align[in] FIELD_ALIGN_LEFT, FIELD_ALIGN_RIGHT or
+    FIELD_ALIGN_CENTER.
+    */
+   LCDField ( LCD &lcd, uint8_t col, uint8_t row, uint8_t width,
+              uint8_t align = FIELD_ALIGN_LEFT );
+
+   /*!
+    @function
+    @abstract   Shows a string.
+    @discussion Characters beyond the width of the field are dropped.
+    @param      text[in] string to show.
+    */
+   void set ( const char *text );
+
+   /*!
+    @function
+    @abstract   Shows a number.
+    @discussion Formatted as LCD::printFixed(), then aligned in the field. A
+    number that doesn't fit fills the field with '*'.
+    @param      value[in] number to show, scaled by 10^decimals.
+    @param      decimals[in] digits after the decimal point.
+    */
+   void set ( long value, uint8_t decimals = 0 );
+
+   /*!
+    @function
+    @abstract   Forgets what the field shows.
+    @discussion The next set() redraws every character of the field.
+    */
+   void invalidate ( );
+
+private:
+   /*!
+    @method
+    @abstract   Aligns a text in the field and writes the changed characters.
+    */
+   void draw ( const char *text, uint8_t length );
+
+   LCD     *_lcd;                     // display showing the field
+   uint8_t  _col;                     // column of the left character
+   uint8_t  _row;                     // row of the field
+   uint8_t  _width;                   // characters of the field
+   uint8_t  _align;                   // FIELD_ALIGN_x of the content
+   uint8_t  _valid;                   // _shadow holds what is displayed
+   char     _shadow[LCD_FIELD_MAX];   // characters displayed
+};
+
+#endif
@@ -0,0 +1,186 @@
+// ---------------------------------------------------------------------------
+// Copyright (C) - 2026
+//
+//    This program is free software: you can redistribute it and/or modify
+//    it under the terms of the GNU General Public License as published by
+//    the Free Software Foundation, either version 3 of the License, or
+//    any later version.
+//
+//    This program is distributed in the hope that it will be useful,
+//    but WITHOUT ANY WARRANTY; without even the implied warranty of
+//    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//    GNU General Public License for more details.
+//
+//    You should have received a copy of the GNU General Public License v3.0
+//    along with this program.
+//    If not, see <https://www.gnu.org/licenses/gpl-3.0.en.html>.
+//
+// ---------------------------------------------------------------------------
+//
+// Thread Safe: No
+// Extendable: Yes
+//
+// @file LCDGlyphSet.cpp
+// This file implements compact custom character sets kept in program memory.
+//
+// @brief
+// A packed bitmap is the bit stream of its 8 rows, 5 bits each, most
+// significant bit first.
+//
+// @version API 1.0.0
+//
+// ---------------------------------------------------------------------------
+#include <string.h>
+#include <inttypes.h>
+
+#if (ARDUINO <  100)
+#include <WProgram.h>
+#else
+#include <Arduino.h>
+#endif
+#include "LCDGlyphSet.h"
+
+//
+// mirror - swaps the 5 pixels of a row
+static uint8_t mirror ( uint8_t row )
+{
+   uint8_t value = 0;
+
+   for ( uint8_t i = 0; i < 5; i++ )
+   {
+      value = ( value << 1 ) | ( row & 0x01 );
+      row >>= 1;
+   }
+   return ( value );
+}
+
+// CONSTRUCTORS
+// ---------------------------------------------------------------------------
+LCDGlyphSet::LCDGlyphSet ( const uint8_t *pool, const uint8_t *refs, uint8_t count,
+                           uint8_t id )
+{
+   _pool  = pool;
+   _refs  = refs;
+   _count = ( count > GLYPHSET_MAX ) ? GLYPHSET_MAX : count;
+   _id    = id;
+
+   for ( uint8_t i = 0; i < GLYPHSET_MAX; i++ )
+   {
+      _location[i] = i;
+   }
+}
+
+// PUBLIC METHODS
+// ---------------------------------------------------------------------------
+
+//
+// load
+uint8_t LCDGlyphSet::load ( LCD &lcd, uint8_t first )
+{
+   uint8_t charmap[8];
+   uint8_t other[8];
+   uint8_t used   = 0;
+   uint8_t upload = ( _id == LCD_GLYPHS_NONE ) || ( lcd.getGlyphSet ( ) != _id );
+
+   for ( uint8_t i = 0; i < _count; i++ )
+   {
+      uint8_t shared = 0;
+
+      get ( i, charmap );
+
+      // A glyph identical to an earlier one shares its character
+      for ( uint8_t j = 0; ( j < i ) && !shared; j++ )
+      {
+         get ( j, other );
+         if ( memcmp ( charmap, other, sizeof ( charmap ) ) == 0 )
+         {
+            _location[i] = _location[j];
+            shared = 1;
+         }
+      }
+
+      if ( !shared )
+      {
+         _location[i] = ( first + used ) & 0x07;
+         if ( upload )
+         {
+            lcd.createChar ( _location[i], charmap );
+         }
+         used++;
+      }
+   }
+
+   if ( upload && ( _id != LCD_GLYPHS_NONE ) )
+   {
+      lcd.setGlyphSet ( _id );
+   }
+   return ( used );
+}
+
+//
+// location
+uint8_t LCDGlyphSet::location ( uint8_t index )
+{
+   return ( ( index < _count ) ? _location[index] : ' ' );
+}
+
+//
+// get
+void LCDGlyphSet::get ( uint8_t index, uint8_t charmap[] )
+{
+   unpack ( _pool, pgm_read_byte ( _refs + index ), charmap );
+}
+
+//
+// unpack
+void LCDGlyphSet::unpack ( const uint8_t *pool, uint8_t ref, uint8_t charmap[] )
+{
+   const uint8_t *packed = pool + ( ref & 0x3F ) * GLYPH_PACKED_SIZE;
+   uint16_t       stream = 0;
+   uint8_t        bits   = 0;
+   uint8_t        row    = 0;
+
+   // 5 bytes in, 8 rows of 5 bits out
+   // --------------------------------
+   for ( uint8_t i = 0; i < GLYPH_PACKED_SIZE; i++ )
+   {
+      stream = ( stream << 8 ) | pgm_read_byte ( packed + i );
+      bits  += 8;
+      while ( bits >= 5 )
+      {
+         uint8_t value;
+
+         bits -= 5;
+         value = ( stream >> bits ) & 0x1F;
+         if ( ref & GLYPH_MIRROR )
+         {
+            value = mirror ( value );
+         }
+         charmap[( ref & GLYPH_FLIP ) ? 7 - row : row] = value;
+         row++;
+      }
+   }
+}
+
+//
+// find
+uint8_t LCDGlyphSet::find ( const uint8_t *pool, uint8_t size, const uint8_t charmap[] )
+{
+   static const uint8_t transform[] = { 0, GLYPH_MIRROR, GLYPH_FLIP, GLYPH_MIRROR | GLYPH_FLIP };
+   uint8_t candidate[8];
+
+   for ( uint8_t index = 0; index < size; index++ )
+   {
+      for ( uint8_t t = 0; t < sizeof ( transform ); t++ )
+      {
+         uint8_t ref = GLYPH_REF ( index, transform[t] );
+
+         unpack ( pool, ref, candidate );
+         if ( memcmp ( charmap, candidate, sizeof ( candidate ) ) == 0 )
+         {
+            return ( ref );
+         }
+      }
+   }
+   return ( GLYPH_NOT_FOUND );
+}
@@ -0,0 +1,179 @@
+// ---------------------------------------------------------------------------
+// Copyright (C) - 2026
+//
+//    This program is free software: you can redistribute it and/or modify
+//    it under the terms of the GNU General Public License as published by
+//    the Free Software Foundation, either version 3 of the License, or
+//    any later version.
+//
+//    This program is distributed in the hope that it will be useful,
+//    but WITHOUT ANY WARRANTY; without even the implied warranty of
+//    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//    GNU General Public License for more details.
+//
+//    You should have received a copy of the GNU General Public License v3.0
+//    along with this program.
+//    If not, see <https://www.gnu.org/licenses/gpl-3.0.en.html>.
+//
+// ---------------------------------------------------------------------------
+//
+// Thread Safe: No
+// Extendable: Yes
+//
+// @file LCDGlyphSet.h
+// This file implements compact custom character sets kept in program memory.
+//
+// @brief
+// The rows of a custom character are 5 bits wide, GLYPH_PACK() stores the 8
+// rows of a bitmap in 5 bytes instead of 8. The bitmaps of all the sets of
+// an application go in a single pool, each bitmap once:
+//
+//    const uint8_t pool[] PROGMEM = {
+//       GLYPH_PACK ( 0x04, 0x0E, 0x15, 0x04, 0x04, 0x04, 0x04, 0x00 ), // arrow
+//       GLYPH_PACK ( 0x0E, 0x11, 0x11, 0x1F, 0x1B, 0x1B, 0x1F, 0x00 )  // lock
+//    };
+//
+// A set lists the bitmaps it uses, one byte each. A glyph can be the mirror
+// image (GLYPH_MIRROR) or upside down version (GLYPH_FLIP) of a pool bitmap,
+// so up/down or left/right variants of an icon share their bitmap:
+//
+//    const uint8_t arrows[] PROGMEM = {
+//       GLYPH_REF ( 0, 0 ), GLYPH_REF ( 0, GLYPH_FLIP ), GLYPH_REF ( 1, 0 )
+//    };
+//    LCDGlyphSet icons ( pool, arrows, 3, LCD_GLYPHS_USER );
+//
+// load() decodes the glyphs as it uploads them. Glyphs of a set that come
+// out identical share one custom character, location() gives the character
+// to write for each glyph.
+//
+// @version API 1.0.0
+//
+// ---------------------------------------------------------------------------
+#ifndef _LCDGLYPHSET_H_
+#define _LCDGLYPHSET_H_
+
+#include <inttypes.h>
+#include "LCD.h"
+
+/*!
+ @defined
+ @abstract   Bytes of a packed bitmap.
+ */
+#define GLYPH_PACKED_SIZE 5
+
+/*!
+ @defined
+ @abstract   Packs the 8 rows of a bitmap in GLYPH_PACKED_SIZE bytes.
+ @discussion Expands to the initializers of the 5 bytes.
+ */
+#define GLYPH_PACK(r0, r1, r2, r3, r4, r5, r6, r7)                              \
+   (uint8_t)( ( ( (r0) & 0x1F ) << 3 ) | ( ( (r1) & 0x1F ) >> 2 ) ),            \
+   (uint8_t)( ( ( (r1) & 0x03 ) << 6 ) | ( ( (r2) & 0x1F ) << 1 ) |             \
+              ( ( (r3) & 0x1F ) >> 4 ) ),                                       \
+   (uint8_t)( ( ( (r3) & 0x0F ) << 4 ) | ( ( (r4) & 0x1F ) >> 1 ) ),            \
+   (uint8_t)( ( ( (r4) & 0x01 ) << 7 ) | ( ( (r5) & 0x1F ) << 2 ) |             \
+              ( ( (r6) & 0x1F ) >> 3 ) ),                                       \
+   (uint8_t)( ( ( (r6) & 0x07 ) << 5 ) | ( (r7) & 0x1F ) )
+
+/*!
+ @defined
+ @abstract   Transformations of a pool bitmap.
+ @discussion GLYPH_MIRROR swaps left and right, GLYPH_FLIP top and bottom,
+ both together turn the bitmap by 180 degrees.
+ */
+#define GLYPH_MIRROR      0x40
+#define GLYPH_FLIP        0x80
+
+/*!
+ @defined
+ @abstract   Glyph of a set, a bitmap of the pool (0 to 63) and its
+ transformation.
+ */
+#define GLYPH_REF(index, flags) (uint8_t)( ( (index) & 0x3F ) | (flags) )
+
+/*!
+ @defined
+ @abstract   Result of find() for a bitmap not in the pool.
+ */
+#define GLYPH_NOT_FOUND   0xFF
+
+/*!
+ @defined
+ @abstract   Maximum number of glyphs of a set.
+ */
+#define GLYPHSET_MAX      8
+
+class LCDGlyphSet
+{
+public:
+   /*!
+    @method
+    @abstract   Class constructor.
+    @param      pool[in] packed bitmaps in program memory.
+    @param      refs[in] GLYPH_REF() of each glyph in program memory.
+    @param      count[in] number of glyphs (1..GLYPHSET_MAX).
+    @param      id[in] LCD_GLYPHS_USER + n to load the set only when not
+    already in CGRAM, LCD_GLYPHS_NONE to load it every time.
+    */
+   LCDGlyphSet ( const uint8_t *pool, const uint8_t *refs, uint8_t count,
+                 uint8_t id = LCD_GLYPHS_NONE );
+
+   /*!
+    @function
+    @abstract   Uploads the glyphs to the custom characters.
+    @discussion Identical glyphs are uploaded once. The locations used start
+    at first.
+    @param      lcd[in] display to load.
+    @param      first[in] first custom character used.
+    @result     number of custom characters used.
+    */
+   uint8_t load ( LCD &lcd, uint8_t first = 0 );
+
+   /*!
+    @function
+    @abstract   Custom character showing a glyph.
+    @discussion Valid after load().
+    @param      index[in] glyph of the set.
+    @result     character to write.
+    */
+   uint8_t location ( uint8_t index );
+
+   /*!
+    @function
+    @abstract   Decodes a glyph of the set.
+    @param      index[in] glyph of the set.
+    @param      charmap[out] 8 rows of the bitmap.
+    */
+   void get ( uint8_t index, uint8_t charmap[] );
+
+   /*!
+    @function
+    @abstract   Decodes a bitmap of a pool.
+    @param      pool[in] packed bitmaps in program memory.
+    @param      ref[in] GLYPH_REF() of the bitmap.
+    @param      charmap[out] 8 rows of the bitmap.
+    */
+   static void unpack ( const uint8_t *pool, uint8_t ref, uint8_t charmap[] );
+
+   /*!
+    @function
+    @abstract   Looks a bitmap up in a pool.
+    @discussion Matches the bitmaps of the pool as they are, mirrored and
+    upside down. Helps building a pool without duplicates, or reusing a pool
+    bitmap for a glyph computed at run time.
+    @param      pool[in] packed bitmaps in program memory.
+    @param      size[in] number of bitmaps in the pool.
+    @param      charmap[in] 8 rows of the bitmap.
+    @result     GLYPH_REF() of the match or GLYPH_NOT_FOUND.
+    */
+   static uint8_t find ( const uint8_t *pool, uint8_t size, const uint8_t charmap[] );
+
+private:
+   const uint8_t *_pool;                     // packed bitmaps
+   const uint8_t *_refs;                     // glyphs of the set
+   uint8_t        _count;                    // number of glyphs
+   uint8_t        _id;                       // LCD_GLYPHS_x id of the set
+   uint8_t        _location[GLYPHSET_MAX];   // custom character of each glyph
+};
+
+#endif
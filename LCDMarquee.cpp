@@ -0,0 +1,160 @@
+// ---------------------------------------------------------------------------
+// Copyright (C) - 2026
+//
+//    This program is free software: you can redistribute it and/or modify
+//    it under the terms of the GNU General Public License as published by
+//    the Free Software Foundation, either version 3 of the License, or
+//    any later version.
+//
+//    This program is distributed in the hope that it will be useful,
+//    but WITHOUT ANY WARRANTY; without even the implied warranty of
+//    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//    GNU General Public License for more details.
+//
+//    You should have received a copy of the GNU General Public License v3.0
+//    along with this program.
+//    If not, see <https://www.gnu.org/licenses/gpl-3.0.en.html>.
+//
+// ---------------------------------------------------------------------------
+//
+// Thread Safe: No
+// Extendable: Yes
+//
+// @file LCDMarquee.cpp
+// This file implements a scrolling marquee (ticker) on a row of any LCD.
+//
+// @brief
+// See LCDMarquee.h for the scrolling modes.
+//
+// @version API 1.0.0
+//
+// ---------------------------------------------------------------------------
+#include <string.h>
+#include <inttypes.h>
+
+#if (ARDUINO <  100)
+#include <WProgram.h>
+#else
+#include <Arduino.h>
+#endif
+#include "LCDMarquee.h"
+
+// CONSTRUCTORS
+// ---------------------------------------------------------------------------
+LCDMarquee::LCDMarquee ( LCD &lcd, uint8_t row, uint8_t mode )
+{
+   _lcd      = &lcd;
+   _row      = row;
+   _mode     = mode;
+   _text     = "";
+   _length   = 0;
+   _period   = 1;
+   _pos      = 0;
+   _column   = 0;
+   _hardware = 0;
+   _ddram    = 0;
+   _interval = 300;
+   _last     = 0;
+}
+
+// PUBLIC METHODS
+// ---------------------------------------------------------------------------
+
+//
+// setText
+void LCDMarquee::setText ( const char *text )
+{
+   uint8_t cols = _lcd->getCols ( );
+
+   _text   = text;
+   _length = strlen ( text );
+   _pos    = 0;
+   _column = 0;
+
+   // The display shift needs a line of its own per row and a hidden column
+   _ddram    = _lcd->ddramWidth ( );
+   _hardware = ( _mode == MARQUEE_AUTO ) && ( _lcd->getRows ( ) <= 2 ) &&
+               ( cols < _ddram );
+
+   if ( _hardware )
+   {
+      // Short text fills the line once, longer text is followed by a blank
+      // window before it repeats.
+      _period = ( _length <= _ddram ) ? _ddram : _length + cols;
+
+      _lcd->home ( );     // display shift back to column 0
+      _lcd->setCursor ( 0, _row );
+      for ( uint8_t i = 0; i < _ddram; i++ )
+      {
+         _lcd->write ( charAt ( i ) );
+      }
+   }
+   else
+   {
+      _period = _length + cols;
+      drawWindow ( );
+   }
+   _last = millis ( );
+}
+
+//
+// step
+void LCDMarquee::step ( )
+{
+   if ( _hardware )
+   {
+      _lcd->scrollDisplayLeft ( );
+
+      // The column that just left the window is the last one to come back,
+      // it takes the character a line length ahead.
+      if ( _period != _ddram )
+      {
+         _lcd->setCursor ( _column, _row );
+         _lcd->write ( charAt ( _pos + _ddram ) );
+      }
+      _column = ( _column + 1 ) % _ddram;
+      _pos    = ( _pos + 1 ) % _period;
+   }
+   else
+   {
+      _pos = ( _pos + 1 ) % _period;
+      drawWindow ( );
+   }
+}
+
+//
+// update
+uint8_t LCDMarquee::update ( )
+{
+   unsigned long now = millis ( );
+
+   if ( now - _last < _interval )
+   {
+      return 0;
+   }
+   _last = now;
+   step ( );
+   return 1;
+}
+
+// PRIVATE METHODS
+// ---------------------------------------------------------------------------
+
+//
+// charAt
+char LCDMarquee::charAt ( uint16_t index )
+{
+   index %= _period;
+   return ( index < _length ) ? _text[index] : ' ';
+}
+
+//
+// drawWindow
+void LCDMarquee::drawWindow ( )
+{
+   _lcd->setCursor ( 0, _row );
+   for ( uint8_t i = 0; i < _lcd->getCols ( ); i++ )
+   {
+      _lcd->write ( charAt ( _pos + i ) );
+   }
+}
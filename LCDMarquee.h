@@ -0,0 +1,129 @@
+// ---------------------------------------------------------------------------
+// Copyright (C) - 2026
+//
+//    This program is free software: you can redistribute it and/or modify
+//    it under the terms of the GNU General Public License as published by
+//    the Free Software Foundation, either version 3 of the License, or
+//    any later version.
+//
+//    This program is distributed in the hope that it will be useful,
+//    but WITHOUT ANY WARRANTY; without even the implied warranty of
+//    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//    GNU General Public License for more details.
+//
+//    You should have received a copy of the GNU General Public License v3.0
+//    along with this program.
+//    If not, see <https://www.gnu.org/licenses/gpl-3.0.en.html>.
+//
+// ---------------------------------------------------------------------------
+//
+// Thread Safe: No
+// Extendable: Yes
+//
+// @file LCDMarquee.h
+// This file implements a scrolling marquee (ticker) on a row of any LCD.
+//
+// @brief
+// Each DDRAM line of the HD44780 holds 40 characters (80 in 1 line mode,
+// see LCD::ddramWidth()) and the display shift command moves the visible
+// window over them. The marquee writes its text into the line once and then
+// scrolls it with a single shift command per step. Text longer than the line
+// is streamed: each step also writes the one character about to enter the
+// window into a hidden column.
+//
+// The display shift moves every row of the display, the marquee then owns
+// the whole display (other rows scroll along, or hold marquees of their
+// own). Displays with more than 2 rows, displays as wide as a line and
+// MARQUEE_SOFTWARE marquees redraw their row at every step instead.
+//
+// @version API 1.0.0
+//
+// ---------------------------------------------------------------------------
+#ifndef _LCDMARQUEE_H_
+#define _LCDMARQUEE_H_
+
+#include <inttypes.h>
+#include "LCD.h"
+
+/*!
+ @defined
+ @abstract   Scrolling modes.
+ @discussion MARQUEE_AUTO uses the display shift when the display allows it,
+ MARQUEE_SOFTWARE always redraws the row, leaving the other rows still.
+ */
+#define MARQUEE_AUTO     0
+#define MARQUEE_SOFTWARE 1
+
+class LCDMarquee
+{
+public:
+   /*!
+    @method
+    @abstract   Class constructor.
+    @discussion The LCD has to be initialized (begin()) before setText().
+    @param      lcd[in] display showing the marquee.
+    @param      row[in] row of the marquee.
+    @param      mode[in] MARQUEE_AUTO or MARQUEE_SOFTWARE.
+    */
+   LCDMarquee ( LCD &lcd, uint8_t row, uint8_t mode = MARQUEE_AUTO );
+
+   /*!
+    @function
+    @abstract   Sets the text and draws the first frame.
+    @discussion The text is not copied, it has to stay valid while the
+    marquee runs. It scrolls in a loop, followed by a blank gap.
+    @param      text[in] zero terminated text.
+    */
+   void setText ( const char *text );
+
+   /*!
+    @function
+    @abstract   Sets the time between steps used by update().
+    @param      ms[in] interval in milliseconds.
+    */
+   void setInterval ( uint16_t ms ) { _interval = ms; }
+
+   /*!
+    @function
+    @abstract   Scrolls the text one character to the left.
+    */
+   void step ( );
+
+   /*!
+    @function
+    @abstract   Scrolls the text when the interval has elapsed.
+    @discussion To be called from loop().
+    @result     1 if the text has scrolled.
+    */
+   uint8_t update ( );
+
+private:
+   /*!
+    @method
+    @abstract   Character at a position of the scrolling text.
+    @discussion The text repeats every _period characters, padded with
+    spaces.
+    */
+   char charAt ( uint16_t index );
+
+   /*!
+    @method
+    @abstract   Writes the visible window of the row.
+    */
+   void drawWindow ( );
+
+   LCD          *_lcd;        // display showing the marquee
+   const char   *_text;       // text scrolled
+   uint16_t      _length;     // characters of the text
+   uint16_t      _period;     // characters of the text and its gap
+   uint16_t      _pos;        // position of the text at the left of the window
+   uint16_t      _interval;   // ms between steps in update()
+   unsigned long _last;       // time of the last step
+   uint8_t       _row;        // row of the marquee
+   uint8_t       _mode;       // MARQUEE_AUTO or MARQUEE_SOFTWARE
+   uint8_t       _hardware;   // scrolled with the display shift
+   uint8_t       _column;     // DDRAM column at the left of the window
+   uint8_t       _ddram;      // characters of the DDRAM line shifted
+};
+
+#endif
@@ -0,0 +1,182 @@
+// ---------------------------------------------------------------------------
+// Copyright (C) - 2026
+//
+//    This program is free software: you can redistribute it and/or modify
+//    it under the terms of the GNU General Public License as published by
+//    the Free Software Foundation, either version 3 of the License, or
+//    any later version.
+//
+//    This program is distributed in the hope that it will be useful,
+//    but WITHOUT ANY WARRANTY; without even the implied warranty of
+//    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//    GNU General Public License for more details.
+//
+//    You should have received a copy of the GNU General Public License v3.0
+//    along with this program.
+//    If not, see <https://www.gnu.org/licenses/gpl-3.0.en.html>.
+//
+// ---------------------------------------------------------------------------
+//
+// Thread Safe: No
+// Extendable: Yes
+//
+// @file LCDSparkline.cpp
+// This file implements a scrolling sparkline (history of a value) on any LCD.
+//
+// @brief
+// See LCDSparkline.h.
+//
+// @version API 1.0.0
+//
+// ---------------------------------------------------------------------------
+#include <inttypes.h>
+
+#if (ARDUINO <  100)
+#include <WProgram.h>
+#else
+#include <Arduino.h>
+#endif
+#include "LCDSparkline.h"
+
+// CONSTRUCTORS
+// ---------------------------------------------------------------------------
+LCDSparkline::LCDSparkline ( LCD &lcd, uint8_t col, uint8_t row, uint8_t cells,
+                             uint8_t rows )
+{
+   _lcd   = &lcd;
+   _col   = col;
+   _row   = row;
+   _cells = ( cells == 0 ) ? 1 : ( ( cells > SPARKLINE_MAX ) ? SPARKLINE_MAX : cells );
+   _rows  = ( rows == 0 ) ? 1 : rows;
+   _min   = 0;
+   _max   = _rows * SPARKLINE_STEPS;
+
+   for ( uint8_t i = 0; i < SPARKLINE_MAX; i++ )
+   {
+      _height[i] = 0;
+   }
+   _valid = 0;
+}
+
+// PUBLIC METHODS
+// ---------------------------------------------------------------------------
+
+//
+// setRange
+void LCDSparkline::setRange ( int min, int max )
+{
+   _min = min;
+   _max = ( max > min ) ? max : min + 1;
+}
+
+//
+// push
+void LCDSparkline::push ( int value )
+{
+   uint8_t full = _rows * SPARKLINE_STEPS;
+   uint8_t height;
+
+   if ( value <= _min )
+   {
+      height = 0;
+   }
+   else if ( value >= _max )
+   {
+      height = full;
+   }
+   else
+   {
+      height = ( ( (long)value - _min ) * full ) / ( (long)_max - _min );
+   }
+
+   loadGlyphs ( );
+
+   // Compare each bar with the one on its right, which takes its place, and
+   // rewrite the run of cells that changed in each row
+   // --------------------------------
+   for ( uint8_t y = 0; y < _rows; y++ )
+   {
+      uint8_t first = _cells;
+      uint8_t last  = 0;
+
+      for ( uint8_t i = 0; i < _cells; i++ )
+      {
+         uint8_t next = ( i + 1 < _cells ) ? _height[i + 1] : height;
+
+         if ( !_valid || ( cell ( _height[i], y ) != cell ( next, y ) ) )
+         {
+            if ( first == _cells )
+            {
+               first = i;
+            }
+            last = i;
+         }
+      }
+
+      if ( first < _cells )
+      {
+         _lcd->setCursor ( _col + first, _row + y );
+         for ( uint8_t i = first; i <= last; i++ )
+         {
+            _lcd->write ( cell ( ( i + 1 < _cells ) ? _height[i + 1] : height, y ) );
+         }
+      }
+   }
+
+   // Scroll the history
+   // --------------------------------
+   for ( uint8_t i = 0; i + 1 < _cells; i++ )
+   {
+      _height[i] = _height[i + 1];
+   }
+   _height[_cells - 1] = height;
+   _valid = 1;
+}
+
+//
+// invalidate
+void LCDSparkline::invalidate ( )
+{
+   _valid = 0;
+}
+
+// PRIVATE METHODS
+// ---------------------------------------------------------------------------
+
+//
+// loadGlyphs
+void LCDSparkline::loadGlyphs ( )
+{
+   uint8_t charmap[8];
+
+   if ( _lcd->getGlyphSet ( ) == LCD_GLYPHS_VBAR )
+   {
+      return;
+   }
+
+   // Glyph n has its n + 1 bottom pixel rows lit
+   for ( uint8_t n = 0; n < SPARKLINE_STEPS; n++ )
+   {
+      for ( uint8_t i = 0; i < 8; i++ )
+      {
+         charmap[i] = ( i + n >= SPARKLINE_STEPS - 1 ) ? 0x1F : 0x00;
+      }
+      _lcd->createChar ( n, charmap );
+   }
+   _lcd->setGlyphSet ( LCD_GLYPHS_VBAR );
+}
+
+//
+// cell
+uint8_t LCDSparkline::cell ( uint8_t height, uint8_t y )
+{
+   // Pixels of the bar below the row
+   uint8_t below = ( _rows - 1 - y ) * SPARKLINE_STEPS;
+
+   if ( height <= below )
+   {
+      return ( ' ' );
+   }
+   height -= below;
+   return ( ( height >= SPARKLINE_STEPS ) ? SPARKLINE_STEPS - 1 : height - 1 );
+}
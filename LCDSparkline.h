@@ -0,0 +1,128 @@
+// ---------------------------------------------------------------------------
+// Copyright (C) - 2026
+//
+//    This program is free software: you can redistribute it and/or modify
+//    it under the terms of the GNU General Public License as published by
+//    the Free Software Foundation, either version 3 of the License, or
+//    any later version.
+//
+//    This program is distributed in the hope that it will be useful,
+//    but WITHOUT ANY WARRANTY; without even the implied warranty of
+//    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//    GNU General Public License for more details.
+//
+//    You should have received a copy of the GNU General Public License v3.0
+//    along with this program.
+//    If not, see <https://www.gnu.org/licenses/gpl-3.0.en.html>.
+//
+// ---------------------------------------------------------------------------
+//
+// Thread Safe: No
+// Extendable: Yes
+//
+// @file LCDSparkline.h
+// This file implements a scrolling sparkline (history of a value) on any LCD.
+//
+// @brief
+// Each cell shows a sample as a vertical bar with the resolution of a pixel
+// row, 8 steps per cell, on one or more rows. New samples enter on the right
+// and the history scrolls to the left.
+//
+// The 8 glyphs of the bars (LCD_GLYPHS_VBAR) fill the CGRAM, they are shared
+// by all the sparklines and loaded only when another set has replaced them.
+// A new sample rewrites only the cells whose fill level changed. Other
+// components using custom characters (bars, big digits, canvas) can't be
+// shown at the same time: they load their glyphs over the bars. push() loads
+// the bar glyphs back when another set has replaced them.
+//
+// After clearing the display call invalidate() so the sparkline is redrawn
+// in full.
+//
+// @version API 1.0.0
+//
+// ---------------------------------------------------------------------------
+#ifndef _LCDSPARKLINE_H_
+#define _LCDSPARKLINE_H_
+
+#include <inttypes.h>
+#include "LCD.h"
+
+/*!
+ @defined
+ @abstract   Pixel rows of a cell.
+ */
+#define SPARKLINE_STEPS 8
+
+/*!
+ @defined
+ @abstract   Maximum number of samples (cells) of a sparkline.
+ */
+#define SPARKLINE_MAX   20
+
+class LCDSparkline
+{
+public:
+   /*!
+    @method
+    @abstract   Class constructor.
+    @discussion The range defaults to 0 .. rows * SPARKLINE_STEPS, one unit
+    per pixel row. The history starts empty, nothing is drawn until push().
+    @param      lcd[in] display showing the sparkline.
+    @param      col[in] column of the left cell.
+    @param      row[in] top row of the sparkline.
+    @param      cells[in] samples shown (1..SPARKLINE_MAX).
+    @param      rows[in] height of the sparkline in rows.
+    */
+   LCDSparkline ( LCD &lcd, uint8_t col, uint8_t row, uint8_t cells,
+                  uint8_t rows = 1 );
+
+   /*!
+    @function
+    @abstract   Sets the values of an empty and a full bar.
+    @param      min[in] value of an empty bar.
+    @param      max[in] value of a full bar.
+    */
+   void setRange ( int min, int max );
+
+   /*!
+    @function
+    @abstract   Adds a sample.
+    @discussion The history scrolls one cell to the left, values out of the
+    range show an empty or full bar.
+    @param      value[in] new sample.
+    */
+   void push ( int value );
+
+   /*!
+    @function
+    @abstract   Forgets what the sparkline shows.
+    @discussion The next push() redraws every cell of the sparkline.
+    */
+   void invalidate ( );
+
+private:
+   /*!
+    @method
+    @abstract   Loads the glyphs of the bars unless already in CGRAM.
+    */
+   void loadGlyphs ( );
+
+   /*!
+    @method
+    @abstract   Character of a row of a bar for its height in pixels.
+    @discussion Row 0 is the top row of the sparkline.
+    */
+   uint8_t cell ( uint8_t height, uint8_t y );
+
+   LCD     *_lcd;                      // display showing the sparkline
+   uint8_t  _col;                      // column of the left cell
+   uint8_t  _row;                      // top row of the sparkline
+   uint8_t  _cells;                    // samples shown
+   uint8_t  _rows;                     // height in rows
+   uint8_t  _valid;                    // _height matches the display
+   int      _min;                      // value of an empty bar
+   int      _max;                      // value of a full bar
+   uint8_t  _height[SPARKLINE_MAX];    // height of each bar in pixels
+};
+
+#endif
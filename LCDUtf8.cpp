@@ -0,0 +1,371 @@
+// ---------------------------------------------------------------------------
+// Copyright (C) - 2026
+//
+//    This program is free software: you can redistribute it and/or modify
+//    it under the terms of the GNU General Public License as published by
+//    the Free Software Foundation, either version 3 of the License, or
+//    any later version.
+//
+//    This program is distributed in the hope that it will be useful,
+//    but WITHOUT ANY WARRANTY; without even the implied warranty of
+//    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//    GNU General Public License for more details.
+//
+//    You should have received a copy of the GNU General Public License v3.0
+//    along with this program.
+//    If not, see <https://www.gnu.org/licenses/gpl-3.0.en.html>.
+//
+// ---------------------------------------------------------------------------
+//
+// Thread Safe: No
+// Extendable: Yes
+//
+// @file LCDUtf8.cpp
+// This file implements a UTF-8 front end for the character ROM of any LCD.
+//
+// @brief
+// ASCII goes to the display unchanged. The half width katakana block and the
+// Latin-1 block are mapped by range, the other characters through sorted
+// tables.
+//
+// @version API 1.0.0
+//
+// ---------------------------------------------------------------------------
+#include <inttypes.h>
+
+#if (ARDUINO <  100)
+#include <WProgram.h>
+#else
+#include <Arduino.h>
+#endif
+#include "LCDUtf8.h"
+
+// A00 ROM characters outside of the katakana block, sorted by code point
+// ---------------------------------------------------------------------------
+static const uint16_t a00CodePoints[] PROGMEM =
+{
+   0x00A2, 0x00A5, 0x00B0, 0x00B5, 0x00B7, 0x00DF, 0x00E4, 0x00F1,
+   0x00F6, 0x00F7, 0x00FC, 0x03A3, 0x03A9, 0x03B1, 0x03B2, 0x03B5,
+   0x03B8, 0x03BC, 0x03C0, 0x03C1, 0x03C3, 0x2190, 0x2192, 0x221A,
+   0x221E, 0x2588, 0x3001, 0x3002, 0x300C, 0x300D, 0x30FB, 0x30FC
+};
+
+static const uint8_t a00Characters[] PROGMEM =
+{
+   0xEC, 0x5C, 0xDF, 0xE4, 0xA5, 0xE2, 0xE1, 0xEE,   // ¢ ¥ ° µ · ß ä ñ
+   0xEF, 0xFD, 0xF5, 0xF6, 0xF4, 0xE0, 0xE2, 0xE3,   // ö ÷ ü Σ Ω α β ε
+   0xF2, 0xE4, 0xF7, 0xE6, 0xE5, 0x7F, 0x7E, 0xE8,   // θ μ π ρ σ ← → √
+   0xF3, 0xFF, 0xA4, 0xA1, 0xA2, 0xA3, 0xA5, 0xB0    // ∞ █ 、 。 「 」 ・ ー
+};
+
+#define A00_ENTRIES ( sizeof ( a00Characters ) )
+
+// Half width katakana block, at 0xA1 in the A00 ROM
+#define KATAKANA_FIRST 0xFF61
+#define KATAKANA_LAST  0xFF9F
+#define KATAKANA_ROM   0xA1
+
+// Latin-1 block, at the same place in the A02 ROM
+#define LATIN1_FIRST   0x00A0
+#define LATIN1_LAST    0x00FF
+
+// Default fallback glyphs
+// ---------------------------------------------------------------------------
+const uint8_t utf8LatinGlyphs[] PROGMEM =
+{
+   UTF8_GLYPH ( 0x005C, 0x00, 0x10, 0x08, 0x04, 0x02, 0x01, 0x00, 0x00 ),  // \\ (backslash)
+   UTF8_GLYPH ( 0x007E, 0x00, 0x00, 0x08, 0x15, 0x02, 0x00, 0x00, 0x00 ),  // ~
+   UTF8_GLYPH ( 0x00C4, 0x0A, 0x00, 0x0E, 0x11, 0x1F, 0x11, 0x11, 0x00 ),  // Ä
+   UTF8_GLYPH ( 0x00D6, 0x0A, 0x00, 0x0E, 0x11, 0x11, 0x11, 0x0E, 0x00 ),  // Ö
+   UTF8_GLYPH ( 0x00DC, 0x0A, 0x00, 0x11, 0x11, 0x11, 0x11, 0x0E, 0x00 ),  // Ü
+   UTF8_GLYPH ( 0x00E0, 0x08, 0x04, 0x0E, 0x01, 0x0F, 0x11, 0x0F, 0x00 ),  // à
+   UTF8_GLYPH ( 0x00E1, 0x02, 0x04, 0x0E, 0x01, 0x0F, 0x11, 0x0F, 0x00 ),  // á
+   UTF8_GLYPH ( 0x00E7, 0x00, 0x0E, 0x10, 0x10, 0x11, 0x0E, 0x04, 0x0C ),  // ç
+   UTF8_GLYPH ( 0x00E8, 0x08, 0x04, 0x0E, 0x11, 0x1F, 0x10, 0x0E, 0x00 ),  // è
+   UTF8_GLYPH ( 0x00E9, 0x02, 0x04, 0x0E, 0x11, 0x1F, 0x10, 0x0E, 0x00 ),  // é
+   UTF8_GLYPH ( 0x00EA, 0x04, 0x0A, 0x0E, 0x11, 0x1F, 0x10, 0x0E, 0x00 ),  // ê
+   UTF8_GLYPH ( 0x00ED, 0x02, 0x04, 0x00, 0x0C, 0x04, 0x04, 0x0E, 0x00 ),  // í
+   UTF8_GLYPH ( 0x00F3, 0x02, 0x04, 0x0E, 0x11, 0x11, 0x11, 0x0E, 0x00 ),  // ó
+   UTF8_GLYPH ( 0x00FA, 0x02, 0x04, 0x11, 0x11, 0x11, 0x13, 0x0D, 0x00 )   // ú
+};
+
+// CONSTRUCTORS
+// ---------------------------------------------------------------------------
+LCDUtf8::LCDUtf8 ( LCD &lcd, uint8_t rom )
+{
+   _lcd        = &lcd;
+   _rom        = rom;
+   _cp         = 0;
+   _pending    = 0;
+   _col        = 0xFF;
+   _row        = 0;
+   _glyphs     = utf8LatinGlyphs;
+   _glyphCount = 0;
+   _first      = 0;
+   _count      = 0;
+   _next       = 0;
+
+   for ( uint8_t i = 0; i < 8; i++ )
+   {
+      _loaded[i] = 0;
+   }
+}
+
+// PUBLIC METHODS
+// ---------------------------------------------------------------------------
+
+//
+// setFallback
+void LCDUtf8::setFallback ( uint8_t first, uint8_t count,
+                            const uint8_t *glyphs, uint8_t size )
+{
+   _first      = first & 0x07;
+   _count      = ( _first + count > 8 ) ? 8 - _first : count;
+   _glyphs     = glyphs;
+   _glyphCount = size;
+   _next       = 0;
+
+   for ( uint8_t i = 0; i < 8; i++ )
+   {
+      _loaded[i] = 0;
+   }
+}
+
+//
+// setCursor
+void LCDUtf8::setCursor ( uint8_t col, uint8_t row )
+{
+   _col = col;
+   _row = row;
+   _lcd->setCursor ( col, row );
+}
+
+//
+// clear
+void LCDUtf8::clear ( )
+{
+   _col = 0;
+   _row = 0;
+   _lcd->clear ( );
+}
+
+//
+// home
+void LCDUtf8::home ( )
+{
+   _col = 0;
+   _row = 0;
+   _lcd->home ( );
+}
+
+//
+// map
+uint8_t LCDUtf8::map ( uint32_t cp )
+{
+   uint8_t low;
+   uint8_t high;
+
+   if ( cp < 0x80 )
+   {
+      // The A00 ROM has ¥ at '\\' and → at '~'
+      if ( ( _rom == LCD_ROM_A00 ) && ( ( cp == '\\' ) || ( cp == '~' ) ) )
+      {
+         return ( 0 );
+      }
+      return ( cp );
+   }
+
+   if ( _rom == LCD_ROM_A02 )
+   {
+      return ( ( ( cp >= LATIN1_FIRST ) && ( cp <= LATIN1_LAST ) ) ? cp : 0 );
+   }
+
+   if ( ( cp >= KATAKANA_FIRST ) && ( cp <= KATAKANA_LAST ) )
+   {
+      return ( cp - KATAKANA_FIRST + KATAKANA_ROM );
+   }
+
+   // Bisection of the A00 table
+   // --------------------------------
+   low  = 0;
+   high = A00_ENTRIES;
+   while ( low < high )
+   {
+      uint8_t  mid   = ( low + high ) >> 1;
+      uint16_t entry = pgm_read_word ( &a00CodePoints[mid] );
+
+      if ( entry == cp )
+      {
+         return ( pgm_read_byte ( &a00Characters[mid] ) );
+      }
+      if ( entry < cp )
+      {
+         low = mid + 1;
+      }
+      else
+      {
+         high = mid;
+      }
+   }
+   return ( 0 );
+}
+
+//
+// write
+#if (ARDUINO <  100)
+void LCDUtf8::write ( uint8_t value )
+#else
+size_t LCDUtf8::write ( uint8_t value )
+#endif
+{
+   if ( ( value & 0xC0 ) == 0x80 )
+   {
+      // Continuation byte
+      if ( _pending != 0 )
+      {
+         _cp = ( _cp << 6 ) | ( value & 0x3F );
+         if ( --_pending == 0 )
+         {
+            emit ( _cp );
+         }
+      }
+   }
+   else
+   {
+      // A sequence cut short
+      if ( _pending != 0 )
+      {
+         _pending = 0;
+         emit ( '?' );
+      }
+
+      if ( value < 0x80 )
+      {
+         emit ( value );
+      }
+      else if ( ( value & 0xE0 ) == 0xC0 )
+      {
+         _cp      = value & 0x1F;
+         _pending = 1;
+      }
+      else if ( ( value & 0xF0 ) == 0xE0 )
+      {
+         _cp      = value & 0x0F;
+         _pending = 2;
+      }
+      else if ( ( value & 0xF8 ) == 0xF0 )
+      {
+         _cp      = value & 0x07;
+         _pending = 3;
+      }
+      else
+      {
+         emit ( '?' );
+      }
+   }
+#if (ARDUINO >= 100)
+   return 1;
+#endif
+}
+
+// PRIVATE METHODS
+// ---------------------------------------------------------------------------
+
+//
+// emit
+void LCDUtf8::emit ( uint32_t cp )
+{
+   uint8_t character = map ( cp );
+
+   if ( ( character == 0 ) && ( cp != 0 ) )
+   {
+      character = ( cp <= 0xFFFF ) ? fallback ( cp ) : '?';
+   }
+
+   _lcd->write ( character );
+   if ( _col != 0xFF )
+   {
+      _col++;
+   }
+}
+
+//
+// fallback
+uint8_t LCDUtf8::fallback ( uint16_t cp )
+{
+   const uint8_t *entry = NULL;
+   uint8_t        charmap[8];
+   uint8_t        low;
+   uint8_t        high;
+   uint8_t        slot;
+
+   if ( _count == 0 )
+   {
+      return ( '?' );
+   }
+
+   // Another glyph set has replaced the fallback glyphs
+   if ( _lcd->getGlyphSet ( ) != LCD_GLYPHS_UTF8 )
+   {
+      for ( uint8_t i = 0; i < 8; i++ )
+      {
+         _loaded[i] = 0;
+      }
+   }
+
+   for ( uint8_t i = 0; i < _count; i++ )
+   {
+      if ( _loaded[i] == cp )
+      {
+         return ( _first + i );
+      }
+   }
+
+   // Uploading needs a known cursor position to come back to
+   if ( _col == 0xFF )
+   {
+      return ( '?' );
+   }
+
+   // Bisection of the fallback table
+   // --------------------------------
+   low  = 0;
+   high = _glyphCount;
+   while ( ( low < high ) && ( entry == NULL ) )
+   {
+      uint8_t        mid   = ( low + high ) >> 1;
+      const uint8_t *probe = _glyphs + mid * UTF8_GLYPH_SIZE;
+      uint16_t       value = ( pgm_read_byte ( probe ) << 8 ) | pgm_read_byte ( probe + 1 );
+
+      if ( value == cp )
+      {
+         entry = probe;
+      }
+      else if ( value < cp )
+      {
+         low = mid + 1;
+      }
+      else
+      {
+         high = mid;
+      }
+   }
+
+   if ( entry == NULL )
+   {
+      return ( '?' );
+   }
+
+   // Reuse the character loaded the longest time ago
+   // --------------------------------
+   slot  = _next;
+   _next = ( _next + 1 < _count ) ? _next + 1 : 0;
+
+   LCDGlyphSet::unpack ( entry + 2, GLYPH_REF ( 0, 0 ), charmap );
+   _lcd->createChar ( _first + slot, charmap );
+   _lcd->setGlyphSet ( LCD_GLYPHS_UTF8 );
+   _lcd->setCursor ( _col, _row );
+   _loaded[slot] = cp;
+
+   return ( _first + slot );
+}
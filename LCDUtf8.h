@@ -0,0 +1,186 @@
+// ---------------------------------------------------------------------------
+// Copyright (C) - 2026
+//
+//    This program is free software: you can redistribute it and/or modify
+//    it under the terms of the GNU General Public License as published by
+//    the Free Software Foundation, either version 3 of the License, or
+//    any later version.
+//
+//    This program is distributed in the hope that it will be useful,
+//    but WITHOUT ANY WARRANTY; without even the implied warranty of
+//    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//    GNU General Public License for more details.
+//
+//    You should have received a copy of the GNU General Public License v3.0
+//    along with this program.
+//    If not, see <https://www.gnu.org/licenses/gpl-3.0.en.html>.
+//
+// ---------------------------------------------------------------------------
+//
+// Thread Safe: No
+// Extendable: Yes
+//
+// @file LCDUtf8.h
+// This file implements a UTF-8 front end for the character ROM of any LCD.
+//
+// @brief
+// LCDUtf8 is a Print: text printed through it is decoded from UTF-8 and each
+// character is mapped to the character ROM of the display:
+//
+//    LCD_ROM_A00  Japanese ROM: ASCII, katakana, some Greek letters and
+//                 symbols (ä, ö, ü, ß, °, µ, arrows ...).
+//    LCD_ROM_A02  European ROM: ASCII and the Latin-1 characters.
+//
+// The tables are sorted in program memory and looked up by bisection.
+//
+// Characters missing from the ROM can be drawn with custom characters: the
+// glyphs of a fallback table (UTF8_GLYPH entries, by default \\, ~ and a few
+// Latin letters missing from the A00 ROM) are uploaded on demand to the custom
+// characters given to setFallback(), reusing the least recently loaded one
+// when they are all taken. A reused character changes everywhere it is
+// shown. Uploading moves the LCD address, the cursor has to be positioned
+// with setCursor() of this class so it can be restored. Anything else prints
+// as '?'.
+//
+// @version API 1.0.0
+//
+// ---------------------------------------------------------------------------
+#ifndef _LCDUTF8_H_
+#define _LCDUTF8_H_
+
+#include <inttypes.h>
+#include <Print.h>
+#include "LCD.h"
+#include "LCDGlyphSet.h"
+
+/*!
+ @defined
+ @abstract   Character ROMs of the HD44780.
+ */
+#define LCD_ROM_A00  0
+#define LCD_ROM_A02  1
+
+/*!
+ @defined
+ @abstract   Bytes of a fallback glyph entry.
+ */
+#define UTF8_GLYPH_SIZE ( 2 + GLYPH_PACKED_SIZE )
+
+/*!
+ @defined
+ @abstract   Fallback glyph of a code point (up to U+FFFF).
+ @discussion Entries of a table have to be sorted by code point.
+ */
+#define UTF8_GLYPH(cp, r0, r1, r2, r3, r4, r5, r6, r7)                         \
+   (uint8_t)( (cp) >> 8 ), (uint8_t)( (cp) & 0xFF ),                          \
+   GLYPH_PACK ( r0, r1, r2, r3, r4, r5, r6, r7 )
+
+/*!
+ @defined
+ @abstract   Glyphs of the default fallback table.
+ */
+#define UTF8_LATIN_GLYPHS 14
+
+/*!
+ @const
+ @abstract   Default fallback table.
+ @discussion Characters missing from the A00 ROM: \\ ~ Ä Ö Ü à á ç è é ê í ó
+ ú. The A00 ROM shows ¥ and → at the ASCII codes of \\ and ~.
+ */
+extern const uint8_t utf8LatinGlyphs[] PROGMEM;
+
+class LCDUtf8 : public Print
+{
+public:
+   /*!
+    @method
+    @abstract   Class constructor.
+    @discussion No custom character is used until setFallback().
+    @param      lcd[in] display written to.
+    @param      rom[in] LCD_ROM_A00 or LCD_ROM_A02.
+    */
+   LCDUtf8 ( LCD &lcd, uint8_t rom = LCD_ROM_A00 );
+
+   /*!
+    @function
+    @abstract   Custom characters used for characters missing from the ROM.
+    @param      first[in] first custom character used.
+    @param      count[in] number of custom characters used, 0 for none.
+    @param      glyphs[in] fallback table in program memory.
+    @param      size[in] number of entries of the table.
+    */
+   void setFallback ( uint8_t first, uint8_t count,
+                      const uint8_t *glyphs = utf8LatinGlyphs,
+                      uint8_t size = UTF8_LATIN_GLYPHS );
+
+   /*!
+    @function
+    @abstract   Positions the cursor.
+    @discussion Same as LCD::setCursor(), the position is kept to be restored
+    after uploading a fallback glyph.
+    */
+   void setCursor ( uint8_t col, uint8_t row );
+
+   /*!
+    @function
+    @abstract   Clears the display, see LCD::clear().
+    */
+   void clear ( );
+
+   /*!
+    @function
+    @abstract   Returns the cursor home, see LCD::home().
+    */
+   void home ( );
+
+   /*!
+    @function
+    @abstract   ROM character of a code point.
+    @param      cp[in] Unicode code point.
+    @result     ROM character, 0 if missing from the ROM.
+    */
+   uint8_t map ( uint32_t cp );
+
+   /*!
+    @function
+    @abstract   Writes a byte of UTF-8 text.
+    @discussion A character is written when its last byte is received,
+    invalid sequences print as '?'.
+    */
+#if (ARDUINO <  100)
+   virtual void write ( uint8_t value );
+#else
+   virtual size_t write ( uint8_t value );
+#endif
+
+   using Print::write;
+
+private:
+   /*!
+    @method
+    @abstract   Writes a decoded code point.
+    */
+   void emit ( uint32_t cp );
+
+   /*!
+    @method
+    @abstract   Custom character showing a code point, loaded if needed.
+    @result     custom character or '?'.
+    */
+   uint8_t fallback ( uint16_t cp );
+
+   LCD           *_lcd;               // display written to
+   uint8_t        _rom;               // LCD_ROM_x of the display
+   uint32_t       _cp;                // code point being decoded
+   uint8_t        _pending;           // continuation bytes expected
+   uint8_t        _col;               // cursor column, 0xFF if unknown
+   uint8_t        _row;               // cursor row
+   const uint8_t *_glyphs;            // fallback table
+   uint8_t        _glyphCount;        // entries of the fallback table
+   uint8_t        _first;             // first custom character used
+   uint8_t        _count;             // custom characters used
+   uint8_t        _next;              // next custom character to reuse
+   uint16_t       _loaded[8];         // code point of each custom character
+};
+
+#endif
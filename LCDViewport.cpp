@@ -0,0 +1,300 @@
+// ---------------------------------------------------------------------------
+// Copyright (C) - 2026
+//
+//    This program is free software: you can redistribute it and/or modify
+//    it under the terms of the GNU General Public License as published by
+//    the Free Software Foundation, either version 3 of the License, or
+//    any later version.
+//
+//    This program is distributed in the hope that it will be useful,
+//    but WITHOUT ANY WARRANTY; without even the implied warranty of
+//    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//    GNU General Public License for more details.
+//
+//    You should have received a copy of the GNU General Public License v3.0
+//    along with this program.
+//    If not, see <https://www.gnu.org/licenses/gpl-3.0.en.html>.
+//
+// ---------------------------------------------------------------------------
+//
+// Thread Safe: No
+// Extendable: Yes
+//
+// @file LCDViewport.cpp
+// This file implements rectangular windows with their own cursor on any LCD.
+//
+// @brief
+// The cursor of the viewport wraps lazily: a full row leaves it past the
+// right edge and the next character moves it to the next row, so a row
+// filled up to the edge and followed by '\n' doesn't leave a blank row.
+//
+// @version API 1.0.0
+//
+// ---------------------------------------------------------------------------
+#include <string.h>
+#include <inttypes.h>
+
+#if (ARDUINO <  100)
+#include <WProgram.h>
+#else
+#include <Arduino.h>
+#endif
+#include "LCDViewport.h"
+
+// CONSTRUCTORS
+// ---------------------------------------------------------------------------
+LCDViewport::LCDViewport ( LCD &lcd, uint8_t col, uint8_t row, uint8_t cols,
+                           uint8_t rows, char *buffer )
+{
+   _lcd    = &lcd;
+   _col    = col;
+   _row    = row;
+   _cols   = ( cols > 0 ) ? cols : 1;
+   _rows   = ( rows > 0 ) ? rows : 1;
+   _buffer = buffer;
+   _x      = 0;
+   _y      = 0;
+   _wrap   = true;
+
+   if ( _buffer != NULL )
+   {
+      memset ( _buffer, ' ', _cols * _rows );
+   }
+}
+
+// PUBLIC METHODS
+// ---------------------------------------------------------------------------
+
+//
+// setCursor
+void LCDViewport::setCursor ( uint8_t col, uint8_t row )
+{
+   _x = ( col < _cols ) ? col : _cols - 1;
+   _y = ( row < _rows ) ? row : _rows - 1;
+}
+
+//
+// clear
+void LCDViewport::clear ( )
+{
+   for ( uint8_t row = 0; row < _rows; row++ )
+   {
+      blank ( 0, row, _cols );
+   }
+   home ( );
+}
+
+//
+// home
+void LCDViewport::home ( )
+{
+   _x = 0;
+   _y = 0;
+}
+
+//
+// setWrap
+void LCDViewport::setWrap ( bool wrap )
+{
+   _wrap = wrap;
+}
+
+//
+// scroll
+void LCDViewport::scroll ( uint8_t lines )
+{
+   if ( ( _buffer == NULL ) || ( lines >= _rows ) )
+   {
+      for ( uint8_t row = 0; row < _rows; row++ )
+      {
+         blank ( 0, row, _cols );
+      }
+      _x = 0;
+      _y = ( _buffer == NULL ) ? 0 : _rows - 1;
+      return;
+   }
+
+   // Each row takes the text of the row lines below, only the run of
+   // characters that differ is rewritten
+   // --------------------------------
+   for ( uint8_t row = 0; row < _rows; row++ )
+   {
+      char    *line  = _buffer + row * _cols;
+      uint8_t  first = _cols;
+      uint8_t  last  = 0;
+
+      if ( row + lines < _rows )
+      {
+         const char *below = line + lines * _cols;
+
+         for ( uint8_t col = 0; col < _cols; col++ )
+         {
+            if ( line[col] != below[col] )
+            {
+               if ( first == _cols )
+               {
+                  first = col;
+               }
+               last = col;
+            }
+         }
+         if ( first < _cols )
+         {
+            memcpy ( line + first, below + first, last - first + 1 );
+            _lcd->setCursor ( _col + first, _row + row );
+            _lcd->write ( (const uint8_t *)line + first, last - first + 1 );
+         }
+      }
+      else
+      {
+         for ( uint8_t col = 0; col < _cols; col++ )
+         {
+            if ( line[col] != ' ' )
+            {
+               if ( first == _cols )
+               {
+                  first = col;
+               }
+               last = col;
+            }
+         }
+         if ( first < _cols )
+         {
+            blank ( first, row, last - first + 1 );
+         }
+      }
+   }
+   _x = 0;
+   _y = _rows - 1;
+}
+
+//
+// redraw
+void LCDViewport::redraw ( )
+{
+   if ( _buffer == NULL )
+   {
+      return;
+   }
+
+   for ( uint8_t row = 0; row < _rows; row++ )
+   {
+      _lcd->setCursor ( _col, _row + row );
+      _lcd->write ( (const uint8_t *)_buffer + row * _cols, _cols );
+   }
+}
+
+//
+// write
+#if (ARDUINO <  100)
+void LCDViewport::write ( uint8_t value )
+{
+   write ( &value, 1 );
+}
+#else
+size_t LCDViewport::write ( uint8_t value )
+{
+   return ( write ( &value, 1 ) );
+}
+#endif
+
+//
+// write
+#if (ARDUINO <  100)
+void LCDViewport::write ( const uint8_t *buffer, size_t size )
+#else
+size_t LCDViewport::write ( const uint8_t *buffer, size_t size )
+#endif
+{
+   size_t index = 0;
+
+   while ( index < size )
+   {
+      uint8_t count = 0;
+
+      if ( buffer[index] == '\n' )
+      {
+         newLine ( );
+         index++;
+         continue;
+      }
+      if ( buffer[index] == '\r' )
+      {
+         _x = 0;
+         index++;
+         continue;
+      }
+
+      // Right edge reached: wrap or drop the character
+      if ( _x >= _cols )
+      {
+         if ( !_wrap )
+         {
+            index++;
+            continue;
+         }
+         newLine ( );
+      }
+
+      // Run of characters fitting in the row
+      // --------------------------------
+      while ( ( index + count < size ) && ( _x + count < _cols ) &&
+              ( buffer[index + count] != '\n' ) && ( buffer[index + count] != '\r' ) )
+      {
+         count++;
+      }
+
+      if ( _buffer != NULL )
+      {
+         memcpy ( _buffer + _y * _cols + _x, buffer + index, count );
+      }
+      _lcd->setCursor ( _col + _x, _row + _y );
+      _lcd->write ( buffer + index, count );
+
+      _x    += count;
+      index += count;
+   }
+#if (ARDUINO >= 100)
+   return ( size );
+#endif
+}
+
+// PRIVATE METHODS
+// ---------------------------------------------------------------------------
+
+//
+// newLine
+void LCDViewport::newLine ( )
+{
+   _x = 0;
+   if ( _y + 1 < _rows )
+   {
+      _y++;
+   }
+   else
+   {
+      scroll ( 1 );
+   }
+}
+
+//
+// blank
+void LCDViewport::blank ( uint8_t col, uint8_t row, uint8_t count )
+{
+   uint8_t spaces[LCD_STREAM_CHUNK];
+
+   if ( _buffer != NULL )
+   {
+      memset ( _buffer + row * _cols + col, ' ', count );
+   }
+
+   memset ( spaces, ' ', sizeof ( spaces ) );
+   _lcd->setCursor ( _col + col, _row + row );
+   while ( count > 0 )
+   {
+      uint8_t chunk = ( count > sizeof ( spaces ) ) ? sizeof ( spaces ) : count;
+
+      _lcd->write ( spaces, chunk );
+      count -= chunk;
+   }
+}
@@ -0,0 +1,170 @@
+// ---------------------------------------------------------------------------
+// Copyright (C) - 2026
+//
+//    This program is free software: you can redistribute it and/or modify
+//    it under the terms of the GNU General Public License as published by
+//    the Free Software Foundation, either version 3 of the License, or
+//    any later version.
+//
+//    This program is distributed in the hope that it will be useful,
+//    but WITHOUT ANY WARRANTY; without even the implied warranty of
+//    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//    GNU General Public License for more details.
+//
+//    You should have received a copy of the GNU General Public License v3.0
+//    along with this program.
+//    If not, see <https://www.gnu.org/licenses/gpl-3.0.en.html>.
+//
+// ---------------------------------------------------------------------------
+//
+// Thread Safe: No
+// Extendable: Yes
+//
+// @file LCDViewport.h
+// This file implements rectangular windows with their own cursor on any LCD.
+//
+// @brief
+// A viewport is a Print writing into a rectangle of the display. Its cursor
+// is relative to the rectangle and positions are turned into DDRAM addresses
+// by LCD::setCursor(), so text never spills into the next DDRAM line (row 0
+// runs into row 2 on 20x4 displays). Text reaching the right edge wraps to
+// the next row, or is clipped when wrapping is off. '\n' starts a new row,
+// '\r' returns to the left edge.
+//
+// Going past the bottom row scrolls the viewport up. Scrolling needs the
+// text of the viewport: give the constructor a buffer of cols * rows
+// characters and only the characters that change are rewritten. Without a
+// buffer scrolling clears the viewport and printing resumes at its top.
+//
+//    char    logText[16 * 3];
+//    LCDViewport log ( lcd, 0, 1, 16, 3, logText );
+//    log.clear ( );
+//    log.println ( "Started" );
+//
+// Runs of characters (print() of strings and numbers) are written with one
+// setCursor() and one LCD::write() per row. Other output moves the LCD
+// cursor: the viewport sets it again before every write.
+//
+// @version API 1.0.0
+//
+// ---------------------------------------------------------------------------
+#ifndef _LCDVIEWPORT_H_
+#define _LCDVIEWPORT_H_
+
+#include <inttypes.h>
+#include <Print.h>
+#include "LCD.h"
+
+class LCDViewport : public Print
+{
+public:
+   /*!
+    @method
+    @abstract   Class constructor.
+    @discussion The rectangle has to be inside the display. The viewport is
+    taken as blank, call clear() to make sure it is.
+    @param      lcd[in] display written to.
+    @param      col[in] column of the left edge.
+    @param      row[in] row of the top edge.
+    @param      cols[in] width of the viewport.
+    @param      rows[in] height of the viewport.
+    @param      buffer[in] cols * rows characters kept by the caller, NULL
+    if the viewport doesn't scroll its text.
+    */
+   LCDViewport ( LCD &lcd, uint8_t col, uint8_t row, uint8_t cols, uint8_t rows,
+                 char *buffer = NULL );
+
+   /*!
+    @function
+    @abstract   Positions the cursor of the viewport.
+    @param      col[in] column in the viewport.
+    @param      row[in] row in the viewport.
+    */
+   void setCursor ( uint8_t col, uint8_t row );
+
+   /*!
+    @function
+    @abstract   Blanks the viewport and moves its cursor home.
+    */
+   void clear ( );
+
+   /*!
+    @function
+    @abstract   Moves the cursor to the top left corner of the viewport.
+    */
+   void home ( );
+
+   /*!
+    @function
+    @abstract   Wraps or clips text reaching the right edge.
+    @param      wrap[in] true to continue on the next row, false to drop the
+    characters up to the next '\n'.
+    */
+   void setWrap ( bool wrap );
+
+   /*!
+    @function
+    @abstract   Scrolls the viewport up.
+    @discussion The bottom rows come up blank and the cursor goes to the
+    start of the bottom row. Without a buffer the viewport is cleared.
+    @param      lines[in] rows to scroll.
+    */
+   void scroll ( uint8_t lines = 1 );
+
+   /*!
+    @function
+    @abstract   Rewrites the whole viewport from its buffer.
+    @discussion For use after the display has been cleared. No effect
+    without a buffer.
+    */
+   void redraw ( );
+
+   /*!
+    @function
+    @abstract   Writes a character at the cursor of the viewport.
+    */
+#if (ARDUINO <  100)
+   virtual void write ( uint8_t value );
+#else
+   virtual size_t write ( uint8_t value );
+#endif
+
+   /*!
+    @function
+    @abstract   Writes a run of characters at the cursor of the viewport.
+    @discussion Each row of the run is written with a single LCD::write().
+    */
+#if (ARDUINO <  100)
+   virtual void write ( const uint8_t *buffer, size_t size );
+#else
+   virtual size_t write ( const uint8_t *buffer, size_t size );
+#endif
+
+   using Print::write;
+
+private:
+   /*!
+    @method
+    @abstract   Moves the cursor to the start of the next row, scrolling
+    past the bottom.
+    */
+   void newLine ( );
+
+   /*!
+    @method
+    @abstract   Writes spaces over a part of a row of the viewport.
+    */
+   void blank ( uint8_t col, uint8_t row, uint8_t count );
+
+   LCD     *_lcd;       // display written to
+   uint8_t  _col;       // column of the left edge
+   uint8_t  _row;       // row of the top edge
+   uint8_t  _cols;      // width of the viewport
+   uint8_t  _rows;      // height of the viewport
+   char    *_buffer;    // text of the viewport, NULL if not kept
+   uint8_t  _x;         // cursor column, _cols once the row is full
+   uint8_t  _y;         // cursor row
+   bool     _wrap;      // wrap text at the right edge
+};
+
+#endif
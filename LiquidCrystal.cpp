@@ -57,6 +57,9 @@
 #define LCD_4BIT                1
 #define LCD_8BIT                0
 
+// Data lines are not consecutive bits of a single port
+#define LCD_NOSHIFT             0xFF
+
 // STATIC helper functions
 // ---------------------------------------------------------------------------
 
@@ -133,14 +136,24 @@ LiquidCrystal::LiquidCrystal(uint8_t rs, uint8_t enable,
 // send
 void LiquidCrystal::send(uint8_t value, uint8_t mode) 
 {
-   // Only interested in COMMAND or DATA
-   digitalWrite( _rs_pin, ( mode == LCD_DATA ) );
-   
-   // if there is a RW pin indicated, set it low to Write
-   // ---------------------------------------------------
-   if (_rw_pin != 255) 
-   { 
-      digitalWrite(_rw_pin, LOW);
+   ATOMIC_BLOCK(ATOMIC_RESTORESTATE)
+   {
+      // Only interested in COMMAND or DATA
+      if ( mode == LCD_DATA )
+      {
+         fio_digitalWrite_HIGH(_rs_reg, _rs_bit);
+      }
+      else
+      {
+         fio_digitalWrite_LOW(_rs_reg, _rs_bit);
+      }
+      
+      // if there is a RW pin indicated, set it low to Write
+      // ---------------------------------------------------
+      if (_rw_pin != 255) 
+      { 
+         fio_digitalWrite_LOW(_rw_reg, _rw_bit);
+      }
    }
    
    if ( mode != FOUR_BITS )
@@ -159,19 +172,32 @@ void LiquidCrystal::send(uint8_t value, uint8_t mode)
    {
       writeNbits ( value, 4 );
    }
-   waitUsec ( EXEC_TIME ); // wait for the command to execute by the LCD
+   // The data lines no longer take long enough to write to cover the LCD
+   // execution time, so always wait for it.
+   delayMicroseconds ( EXEC_TIME );
 }
 
 //
 // setBacklightPin
 void LiquidCrystal::setBacklightPin ( uint8_t pin, t_backlightPol pol )
 {
-   pinMode ( pin, OUTPUT );       // Difine the backlight pin as output
+   // Difine the backlight pin as output
+   _backlightReg = fio_pinToOutputRegister ( pin );
+   _backlightBit = fio_pinToBit ( pin );
    _backlightPin = pin;
    _polarity = pol;
    setBacklight(BACKLIGHT_OFF);   // Set the backlight low by default
 }
 
+//
+// setEnable2Pin
+void LiquidCrystal::setEnable2Pin ( uint8_t pin )
+{
+   _enable2_reg = fio_pinToOutputRegister ( pin );
+   _enable2_bit = fio_pinToBit ( pin );
+   _controllers = 2;
+}
+
 //
 // ESP32 complains if not included
 #if defined(ARDUINO_ARCH_ESP32)
@@ -224,11 +250,17 @@ void LiquidCrystal::setBacklight ( uint8_t value )
       else if (((value > 0) && (_polarity == POSITIVE)) ||
                ((value == 0) && (_polarity == NEGATIVE)))
       {
-         digitalWrite( _backlightPin, HIGH);
+         ATOMIC_BLOCK(ATOMIC_RESTORESTATE)
+         {
+            fio_digitalWrite_HIGH(_backlightReg, _backlightBit);
+         }
       }
       else
       {
-         digitalWrite( _backlightPin, LOW);
+         ATOMIC_BLOCK(ATOMIC_RESTORESTATE)
+         {
+            fio_digitalWrite_LOW(_backlightReg, _backlightBit);
+         }
       }
    }
 }
@@ -278,15 +310,73 @@ void LiquidCrystal::init(uint8_t fourbitmode, uint8_t rs, uint8_t rw, uint8_t en
          pinMode ( _data_pins[i], OUTPUT );
       }
    }
-   pinMode(_rs_pin, OUTPUT);
+   // Control lines as outputs, pulled LOW to begin commands
+   // ------------------------------------------
+   _rs_reg = fio_pinToOutputRegister ( _rs_pin );
+   _rs_bit = fio_pinToBit ( _rs_pin );
    
    // we can save 1 pin by not using RW. Indicate by passing 255 instead of pin#
    if (_rw_pin != 255) 
    { 
-      pinMode(_rw_pin, OUTPUT);
+      _rw_reg = fio_pinToOutputRegister ( _rw_pin );
+      _rw_bit = fio_pinToBit ( _rw_pin );
    }
    
-   pinMode(_enable_pin, OUTPUT);
+   _enable_reg = fio_pinToOutputRegister ( _enable_pin );
+   _enable_bit = fio_pinToBit ( _enable_pin );
+   
+#ifndef FIO_FALLBACK
+   // Group the data lines by port
+   // ------------------------------------------
+   _dataWidth = fourbitmode ? 4 : 8;
+   _numDataPorts = 0;
+   
+   for ( i = 0; i < _dataWidth; i++ )
+   {
+      fio_register reg = fio_pinToOutputRegister ( _data_pins[i] );
+      uint8_t port;
+      
+      for ( port = 0; port < _numDataPorts; port++ )
+      {
+         if ( _dataPortReg[port] == reg )
+         {
+            break;
+         }
+      }
+      if ( port == _numDataPorts )
+      {
+         _dataPortReg[port]  = reg;
+         _dataPortMask[port] = 0;
+         _numDataPorts++;
+      }
+      _dataPort[i] = port;
+      _dataBit[i]  = fio_pinToBit ( _data_pins[i] );
+      _dataPortMask[port] |= _dataBit[i];
+   }
+   
+   // All the lines in order on consecutive bits of one port: the value is
+   // written shifted into place.
+   // ------------------------------------------
+   _dataShift = LCD_NOSHIFT;
+   if ( _numDataPorts == 1 )
+   {
+      for ( i = 0; i < sizeof(fio_bit) * 8; i++ )
+      {
+         if ( _dataBit[0] == ((fio_bit)1 << i) )
+         {
+            _dataShift = i;
+            break;
+         }
+      }
+      for ( i = 1; ( i < _dataWidth ) && ( _dataShift != LCD_NOSHIFT ); i++ )
+      {
+         if ( _dataBit[i] != (fio_bit)(_dataBit[0] << i) )
+         {
+            _dataShift = LCD_NOSHIFT;
+         }
+      }
+   }
+#endif
    
    // Initialise displaymode functions to defaults: LCD_1LINE and LCD_5x8DOTS
    // -------------------------------------------------------------------------
@@ -295,15 +385,6 @@ void LiquidCrystal::init(uint8_t fourbitmode, uint8_t rs, uint8_t rw, uint8_t en
    else 
       _displayfunction = LCD_8BITMODE | LCD_1LINE | LCD_5x8DOTS;
    
-   // Now we pull both RS and R/W low to begin commands
-   digitalWrite(_rs_pin, LOW);
-   digitalWrite(_enable_pin, LOW);
-   
-   if (_rw_pin != 255) 
-   { 
-      digitalWrite(_rw_pin, LOW);
-   }
-   
    // Initialise the backlight pin no nothing
    _backlightPin = LCD_NOBACKLIGHT;
    _polarity = POSITIVE;
@@ -313,21 +394,84 @@ void LiquidCrystal::init(uint8_t fourbitmode, uint8_t rs, uint8_t rw, uint8_t en
 // pulseEnable
 void LiquidCrystal::pulseEnable(void) 
 {
-   // There is no need for the delays, since the digitalWrite operation
-   // takes longer.
-   digitalWrite(_enable_pin, HIGH);   
-   waitUsec(1);          // enable pulse must be > 450ns   
-   digitalWrite(_enable_pin, LOW);
+   ATOMIC_BLOCK(ATOMIC_RESTORESTATE)
+   {
+      if ( _controller & LCD_CONTROLLER_1 )
+      {
+         fio_digitalWrite_HIGH(_enable_reg, _enable_bit);
+      }
+      if ( ( _controller & LCD_CONTROLLER_2 ) && ( _controllers > 1 ) )
+      {
+         fio_digitalWrite_HIGH(_enable2_reg, _enable2_bit);
+      }
+   }
+   delayMicroseconds(1);    // enable pulse must be > 450ns
+   ATOMIC_BLOCK(ATOMIC_RESTORESTATE)
+   {
+      fio_digitalWrite_LOW(_enable_reg, _enable_bit);
+      if ( _controllers > 1 )
+      {
+         fio_digitalWrite_LOW(_enable2_reg, _enable2_bit);
+      }
+   }
+   delayMicroseconds(1);    // enable cycle must be > 1000ns
 }
 
 //
 // write4bits
 void LiquidCrystal::writeNbits(uint8_t value, uint8_t numBits) 
 {
+#ifdef FIO_FALLBACK
    for (uint8_t i = 0; i < numBits; i++) 
    {
       digitalWrite(_data_pins[i], (value >> i) & 0x01);
    }
+#else
+   if ( ( _dataShift != LCD_NOSHIFT ) && ( numBits == _dataWidth ) )
+   {
+      // One port, consecutive bits
+      ATOMIC_BLOCK(ATOMIC_RESTORESTATE)
+      {
+         fio_digitalWrite_PORT(_dataPortReg[0], _dataPortMask[0], 
+                               (fio_bit)value << _dataShift);
+      }
+   }
+   else
+   {
+      fio_bit portValue[8];
+      fio_bit portMask[8];
+      uint8_t port;
+      
+      // Build the value and mask of each port
+      for ( port = 0; port < _numDataPorts; port++ )
+      {
+         portValue[port] = 0;
+         portMask[port]  = 0;
+      }
+      for ( uint8_t i = 0; i < numBits; i++ )
+      {
+         port = _dataPort[i];
+         portMask[port] |= _dataBit[i];
+         if ( value & 0x01 )
+         {
+            portValue[port] |= _dataBit[i];
+         }
+         value >>= 1;
+      }
+      
+      ATOMIC_BLOCK(ATOMIC_RESTORESTATE)
+      {
+         for ( port = 0; port < _numDataPorts; port++ )
+         {
+            if ( portMask[port] )
+            {
+               fio_digitalWrite_PORT(_dataPortReg[port], portMask[port], 
+                                     portValue[port]);
+            }
+         }
+      }
+   }
+#endif
    pulseEnable();
 }
 
@@ -120,6 +120,18 @@ public:
     */
    void setBacklightPin ( uint8_t pin, t_backlightPol pol );
    
+   /*!
+    @function
+    @abstract   Sets the enable pin of the second controller.
+    @discussion 40x4 displays have two controllers sharing RS, RW and the data
+    lines, each with its own enable pin (E1 for rows 0-1, E2 for rows 2-3).
+    Call it before begin(cols, 4), the enable pin given to the constructor
+    drives E1.
+    
+    @param      pin: pin connected to E2.
+    */
+   void setEnable2Pin ( uint8_t pin );
+   
 #if defined(ARDUINO_ARCH_ESP32)
    /*!
     @function
@@ -166,7 +178,9 @@ private:
     @method     
     @abstract   Writes numBits bits from value value to the LCD.
     @discussion Writes numBists bits (the least significant) to the LCD control 
-    data lines.
+    data lines. The lines are written with one masked write per port they
+    are on, and with a single shifted write when they sit in order on
+    consecutive bits of one port.
     */   
    void writeNbits(uint8_t value, uint8_t numBits);
    
@@ -174,7 +188,9 @@ private:
     @method     
     @abstract   Pulse the LCD enable line (En).
     @discussion Sends a pulse of 1 uS to the Enable pin to execute an command
-    or write operation.
+    or write operation. The pulse and the following low time are timed
+    since the fio writes are far shorter than the LCD minimums. Both enable
+    lines are pulsed together when both controllers are addressed.
     */ 
    void pulseEnable();
    
@@ -183,6 +199,25 @@ private:
    uint8_t _enable_pin;   // activated by a HIGH pulse.
    uint8_t _data_pins[8]; // Data pins.
    uint8_t _backlightPin; // Pin associated to control the LCD backlight
+   fio_register _rs_reg;       // RS pin MCU register
+   fio_bit      _rs_bit;       // RS pin bit
+   fio_register _rw_reg;       // RW pin MCU register
+   fio_bit      _rw_bit;       // RW pin bit
+   fio_register _enable_reg;   // EN pin MCU register
+   fio_bit      _enable_bit;   // EN pin bit
+   fio_register _enable2_reg;  // second controller EN pin MCU register
+   fio_bit      _enable2_bit;  // second controller EN pin bit
+   fio_register _backlightReg; // Backlight pin MCU register
+   fio_bit      _backlightBit; // Backlight pin bit
+#ifndef FIO_FALLBACK
+   fio_register _dataPortReg[8];  // Output register of each port used by the data lines
+   fio_bit      _dataPortMask[8]; // Data lines mask of each port
+   fio_bit      _dataBit[8];      // Port bit of each data line
+   uint8_t      _dataPort[8];     // Port index (_dataPortReg) of each data line
+   uint8_t      _numDataPorts;    // Number of ports used by the data lines
+   uint8_t      _dataWidth;       // Number of data lines, 4 or 8
+   uint8_t      _dataShift;       // Shift of the data lines in a single port
+#endif
 };
 
 #endif
@@ -174,6 +174,14 @@ void LiquidCrystal_I2C::setBacklightPin ( uint8_t value, t_backlightPol pol = PO
    setBacklight(BACKLIGHT_OFF);
 }
 
+//
+// setEnable2Pin
+void LiquidCrystal_I2C::setEnable2Pin ( uint8_t value )
+{
+   _En2 = ( 1 << value );
+   _controllers = 2;
+}
+
 //
 // setBacklight
 void LiquidCrystal_I2C::setBacklight( uint8_t value ) 
@@ -232,14 +240,11 @@ void LiquidCrystal_I2C::config (uint8_t lcd_Addr, uint8_t En, uint8_t Rw, uint8_
    _polarity = POSITIVE;
    
    _En = ( 1 << En );
+   _En2 = 0;
    _Rw = ( 1 << Rw );
    _Rs = ( 1 << Rs );
    
-   // Initialise pin mapping
-   _data_pins[0] = ( 1 << d4 );
-   _data_pins[1] = ( 1 << d5 );
-   _data_pins[2] = ( 1 << d6 );
-   _data_pins[3] = ( 1 << d7 );   
+   mapNibbles ( _nibbleMap, d4, d5, d6, d7 );
 }
 
 
@@ -267,21 +272,79 @@ void LiquidCrystal_I2C::send(uint8_t value, uint8_t mode)
 }
 
 //
-// write4bits
-void LiquidCrystal_I2C::write4bits ( uint8_t value, uint8_t mode ) 
+// batchPad - idle bytes after each character of a batch
+static uint8_t batchPad ( )
 {
-   uint8_t pinMapValue = 0;
+   uint32_t clock = I2C_BATCH_CLOCK;
+   uint8_t  bytes;
    
-   // Map the value to LCD pin mapping
-   // --------------------------------
-   for ( uint8_t i = 0; i < 4; i++ )
+#if defined(TWBR) && defined(TWSR)
+   clock = F_CPU / ( 16 + 2UL * TWBR * ( 1 << ( 2 * ( TWSR & 0x03 ) ) ) );
+#endif
+   // Bytes of 9 bit times lasting 40us, 2 are sent anyway
+   bytes = ( 40UL * ( clock / 1000 ) + 8999 ) / 9000;
+   if ( bytes <= 2 )
+   {
+      return 0;
+   }
+   bytes -= 2;
+   return ( bytes > I2CIO_BATCH - 4 ) ? I2CIO_BATCH - 4 : bytes;
+}
+
+//
+// write - characters batched in I2C transactions
+#if (ARDUINO <  100)
+void LiquidCrystal_I2C::write(const uint8_t *buffer, size_t size)
+#else
+size_t LiquidCrystal_I2C::write(const uint8_t *buffer, size_t size)
+#endif
+{
+   uint8_t batch[I2CIO_BATCH];
+   uint8_t count = 0;
+   uint8_t pad = batchPad ( );
+   uint8_t enable = ( _controller & LCD_CONTROLLER_1 ) ? _En : 0;
+   
+   if ( _controller & LCD_CONTROLLER_2 )
    {
-      if ( ( value & 0x1 ) == 1 )
+      enable |= _En2;
+   }
+   
+   for ( size_t i = 0; i < size; i++ )
+   {
+      uint8_t high = _nibbleMap[buffer[i] >> 4] | _Rs | _backlightStsMask;
+      uint8_t low  = _nibbleMap[buffer[i] & 0x0F] | _Rs | _backlightStsMask;
+      
+      batch[count++] = high | enable;   // En HIGH
+      batch[count++] = high & ~enable;  // En LOW
+      batch[count++] = low | enable;
+      batch[count++] = low & ~enable;
+      for ( uint8_t j = 0; j < pad; j++ )
+      {
+         batch[count++] = low & ~enable;  // idle, see I2C_BATCH_CLOCK
+      }
+      
+      if ( count + 4 + pad > I2CIO_BATCH )
       {
-         pinMapValue |= _data_pins[i];
+         _i2cio.write ( batch, count );
+         count = 0;
       }
-      value = ( value >> 1 );
    }
+   if ( count > 0 )
+   {
+      _i2cio.write ( batch, count );
+   }
+#if (ARDUINO >= 100)
+   return size;
+#endif
+}
+
+//
+// write4bits
+void LiquidCrystal_I2C::write4bits ( uint8_t value, uint8_t mode ) 
+{
+   // Map the value to LCD pin mapping
+   // --------------------------------
+   uint8_t pinMapValue = _nibbleMap[value & 0x0F];
    
    // Is it a command or data
    // -----------------------
@@ -298,6 +361,13 @@ void LiquidCrystal_I2C::write4bits ( uint8_t value, uint8_t mode )
 // pulseEnable
 void LiquidCrystal_I2C::pulseEnable (uint8_t data)
 {
-   _i2cio.write (data | _En);   // En HIGH
-   _i2cio.write (data & ~_En);  // En LOW
+   // Enable lines of the addressed controllers
+   uint8_t enable = ( _controller & LCD_CONTROLLER_1 ) ? _En : 0;
+   
+   if ( _controller & LCD_CONTROLLER_2 )
+   {
+      enable |= _En2;
+   }
+   _i2cio.write (data | enable);   // En HIGH
+   _i2cio.write (data & ~enable);  // En LOW
 }
\ No newline at end of file
@@ -46,6 +46,21 @@
 #include "I2CIO.h"
 #include "LCD.h"
 
+/*!
+ @defined
+ @abstract   I2C clock assumed by the batched writes.
+ @discussion write(buffer, size) sends the characters back to back with no
+ delay, the LCD execution time (37us) is only covered by the bus time of
+ the bytes between the last enable pulse of a character and the one
+ latching the next: 2 bytes, 45us at 400kHz. At faster clocks idle bytes
+ (enable low) are added after each character to keep 40us. On AVR the clock
+ is read from the TWI registers, elsewhere this value is used: define it
+ for the whole build when setting a faster Wire clock (1MHz Fast-mode Plus).
+ */
+#ifndef I2C_BATCH_CLOCK
+#define I2C_BATCH_CLOCK 400000
+#endif
+
 
 class LiquidCrystal_I2C : public LCD
 {
@@ -135,6 +150,24 @@ public:
     */
    virtual void send(uint8_t value, uint8_t mode);
 
+   /*!
+    @function
+    @abstract   Writes a run of characters to the LCD.
+    @discussion The expander values of several characters (two enable
+    pulses per nibble) are sent in a single I2C transaction instead of one
+    transaction per value. The bus time between characters stands for the
+    LCD execution time, see I2C_BATCH_CLOCK.
+
+    @param      buffer[in] characters to write.
+    @param      size[in] number of characters.
+    */
+#if (ARDUINO <  100)
+   virtual void write(const uint8_t *buffer, size_t size);
+#else
+   virtual size_t write(const uint8_t *buffer, size_t size);
+#endif
+   using LCD::write;
+
    /*!
     @function
     @abstract   Sets the pin to control the backlight.
@@ -145,6 +178,17 @@ public:
     */
    void setBacklightPin ( uint8_t value, t_backlightPol pol );
 
+   /*!
+    @function
+    @abstract   Sets the expander pin driving the second controller enable.
+    @discussion 40x4 displays have a second controller with its own enable
+    pin (E2, rows 2-3). It needs a free expander pin, Rw tied to GND or no
+    backlight control. Call it before begin(cols, 4).
+
+    @param      value: expander pin (0..7) connected to E2.
+    */
+   void setEnable2Pin ( uint8_t value );
+
    /*!
     @function
     @abstract   Switch-on/off the LCD backlight.
@@ -208,9 +252,10 @@ private:
    uint8_t _backlightStsMask; // Backlight status mask
    I2CIO   _i2cio;            // I2CIO PCF8574* expansion module driver I2CLCDextraIO
    uint8_t _En;               // LCD expander word for enable pin
+   uint8_t _En2;              // LCD expander word for second controller enable pin
    uint8_t _Rw;               // LCD expander word for R/W pin
    uint8_t _Rs;               // LCD expander word for Register Select pin
-   uint8_t _data_pins[4];     // LCD data lines
+   uint8_t _nibbleMap[16];    // LCD data lines word of each nibble
 
 };
 
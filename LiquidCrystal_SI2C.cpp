@@ -180,6 +180,14 @@ void LiquidCrystal_SI2C::setBacklightPin ( uint8_t value, t_backlightPol pol = P
    setBacklight(BACKLIGHT_OFF);
 }
 
+//
+// setEnable2Pin
+void LiquidCrystal_SI2C::setEnable2Pin ( uint8_t value )
+{
+   _En2 = ( 1 << value );
+   _controllers = 2;
+}
+
 //
 // setBacklight
 void LiquidCrystal_SI2C::setBacklight( uint8_t value ) 
@@ -238,14 +246,11 @@ void LiquidCrystal_SI2C::config (uint8_t lcd_Addr, uint8_t En, uint8_t Rw, uint8
    _polarity = POSITIVE;
    
    _En = ( 1 << En );
+   _En2 = 0;
    _Rw = ( 1 << Rw );
    _Rs = ( 1 << Rs );
    
-   // Initialise pin mapping
-   _data_pins[0] = ( 1 << d4 );
-   _data_pins[1] = ( 1 << d5 );
-   _data_pins[2] = ( 1 << d6 );
-   _data_pins[3] = ( 1 << d7 );   
+   mapNibbles ( _nibbleMap, d4, d5, d6, d7 );
 }
 
 
@@ -276,18 +281,9 @@ void LiquidCrystal_SI2C::send(uint8_t value, uint8_t mode)
 // write4bits
 void LiquidCrystal_SI2C::write4bits ( uint8_t value, uint8_t mode ) 
 {
-   uint8_t pinMapValue = 0;
-   
    // Map the value to LCD pin mapping
    // --------------------------------
-   for ( uint8_t i = 0; i < 4; i++ )
-   {
-      if ( ( value & 0x1 ) == 1 )
-      {
-         pinMapValue |= _data_pins[i];
-      }
-      value = ( value >> 1 );
-   }
+   uint8_t pinMapValue = _nibbleMap[value & 0x0F];
    
    // Is it a command or data
    // -----------------------
@@ -304,8 +300,15 @@ void LiquidCrystal_SI2C::write4bits ( uint8_t value, uint8_t mode )
 // pulseEnable
 void LiquidCrystal_SI2C::pulseEnable (uint8_t data)
 {
-   _si2cio.write (data | _En);   // En HIGH
-   _si2cio.write (data & ~_En);  // En LOW
+   // Enable lines of the addressed controllers
+   uint8_t enable = ( _controller & LCD_CONTROLLER_1 ) ? _En : 0;
+   
+   if ( _controller & LCD_CONTROLLER_2 )
+   {
+      enable |= _En2;
+   }
+   _si2cio.write (data | enable);   // En HIGH
+   _si2cio.write (data & ~enable);  // En LOW
 }
 
 #endif // defined (__AVR__)
@@ -150,6 +150,17 @@ public:
     @param      0: backlight off, 1..255: backlight on.
     */
    void setBacklightPin ( uint8_t value, t_backlightPol pol );
+
+   /*!
+    @function
+    @abstract   Sets the expander pin driving the second controller enable.
+    @discussion 40x4 displays have a second controller with its own enable
+    pin (E2, rows 2-3). It needs a free expander pin, Rw tied to GND or no
+    backlight control. Call it before begin(cols, 4).
+
+    @param      value: expander pin (0..7) connected to E2.
+    */
+   void setEnable2Pin ( uint8_t value );
    
    /*!
     @function
@@ -215,9 +226,10 @@ private:
    uint8_t _backlightStsMask; // Backlight status mask
    SI2CIO  _si2cio;            // I2CIO PCF8574* expansion module driver I2CLCDextraIO
    uint8_t _En;               // LCD expander word for enable pin
+   uint8_t _En2;              // LCD expander word for second controller enable pin
    uint8_t _Rw;               // LCD expander word for R/W pin
    uint8_t _Rs;               // LCD expander word for Register Select pin
-   uint8_t _data_pins[4];     // LCD data lines
+   uint8_t _nibbleMap[16];    // LCD data lines word of each nibble
    
 };
 
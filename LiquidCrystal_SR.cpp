@@ -102,6 +102,9 @@
 #include "LiquidCrystal_SR.h"
 
 #include "FastIO.h"
+#ifdef FIO_HW_SPI
+#include <SPI.h>
+#endif
 
 
 // CONSTRUCTORS
@@ -124,13 +127,28 @@ void LiquidCrystal_SR::init(uint8_t srdata, uint8_t srclock, uint8_t enable,
 {
    // Initialise private variables
    _two_wire = 0;
+   _spi = ( srdata == HW_SPI ) ? SR_SPI : 0;
+   _displayfunction = LCD_4BITMODE | LCD_1LINE | LCD_5x8DOTS;
    
-   _srDataRegister = fio_pinToOutputRegister(srdata);
-   _srDataBit = fio_pinToBit(srdata);
-   _srClockRegister = fio_pinToOutputRegister(srclock);
-   _srClockBit = fio_pinToBit(srclock);
+   // The data line is the SPI MOSI, it can't be the enable signal: HW_SPI
+   // needs a latch pin. Without one nothing is sent to the LCD.
+   if (_spi && ((enable == TWO_WIRE) || (enable == HW_SPI)))
+   {
+      _spi = SR_SPI_NO_LATCH;
+      return;
+   }
+   
+   // Data and clock are driven by the SPI peripheral when HW_SPI is used,
+   // it is initialised in begin().
+   if ( !_spi )
+   {
+      _srDataRegister = fio_pinToOutputRegister(srdata);
+      _srDataBit = fio_pinToBit(srdata);
+      _srClockRegister = fio_pinToOutputRegister(srclock);
+      _srClockBit = fio_pinToBit(srclock);
+   }
    
-   if ((enable == TWO_WIRE) || (enable == srdata))
+   if (!_spi && ((enable == TWO_WIRE) || (enable == srdata)))
    {
       _two_wire = 1;
       _srEnableRegister = _srDataRegister;
@@ -144,20 +162,38 @@ void LiquidCrystal_SR::init(uint8_t srdata, uint8_t srclock, uint8_t enable,
    
    // Configure control pins as outputs
    // ------------------------------------------------------------------------
-   
-   _displayfunction = LCD_4BITMODE | LCD_1LINE | LCD_5x8DOTS;
 }
 
 //
 // shiftIt
 void LiquidCrystal_SR::shiftIt(uint8_t val)
 {
-   if (_two_wire)
+   if (_spi == SR_SPI_NO_LATCH)
+   {
+      return;
+   }
+   
+   if (_spi)
+   {
+#ifdef FIO_HW_SPI
+#ifdef SPI_HAS_TRANSACTION
+      SPI.beginTransaction ( SPISettings ( SR_SPI_CLOCK, MSBFIRST, SPI_MODE0 ) );
+      SPI.transfer ( val );
+      SPI.endTransaction ( );
+#else
+      SPI.transfer ( val );
+#endif
+#endif
+   }
+   else
    {
-      // Clear to get Enable LOW
-      fio_shiftOut(_srDataRegister, _srDataBit, _srClockRegister, _srClockBit);
+      if (_two_wire)
+      {
+         // Clear to get Enable LOW
+         fio_shiftOut(_srDataRegister, _srDataBit, _srClockRegister, _srClockBit);
+      }
+      fio_shiftOut(_srDataRegister, _srDataBit, _srClockRegister, _srClockBit, val, MSBFIRST);
    }
-   fio_shiftOut(_srDataRegister, _srDataBit, _srClockRegister, _srClockBit, val, MSBFIRST);
    
    // LCD ENABLE PULSE
    //
@@ -166,7 +202,7 @@ void LiquidCrystal_SR::shiftIt(uint8_t val)
    // latch. The shiftregister latch pin (STR, RCL or similar) is then
    // connected to the LCD enable pin. The LCD is (very likely) slower
    // to read the Enable pulse, and then reads the new contents of the SR.
-   ATOMIC_BLOCK(ATOMIC_RESTORESTATE)
+   FIO_OP_BLOCK
    {
       fio_digitalWrite_HIGH(_srEnableRegister, _srEnableBit);
       delayMicroseconds (1);         // enable pulse must be >450ns               
@@ -177,6 +213,24 @@ void LiquidCrystal_SR::shiftIt(uint8_t val)
 // PUBLIC METHODS
 // ---------------------------------------------------------------------------
 
+//
+// begin
+void LiquidCrystal_SR::begin(uint8_t cols, uint8_t lines, uint8_t dotsize)
+{
+   if (_spi == SR_SPI)
+   {
+#ifdef FIO_HW_SPI
+      SPI.begin();
+#ifndef SPI_HAS_TRANSACTION
+      SPI.setBitOrder(MSBFIRST);
+      SPI.setDataMode(SPI_MODE0);
+      SPI.setClockDivider(SPI_CLOCK_DIV2);
+#endif
+#endif
+   }
+   LCD::begin ( cols, lines, dotsize );
+}
+
 
 /************ low level data pushing commands **********/
 //
@@ -199,10 +253,12 @@ void LiquidCrystal_SR::send(uint8_t value, uint8_t mode)
     * even on AVRs because the shiftout is shorter than the LCD command execution time.
     */
 #if (F_CPU <= 16000000)
-   if(_two_wire)
-   	delayMicroseconds ( 10 );
+   if(_spi)
+   	delayMicroseconds ( 37 ); // SPI loads take next to no time
+   else if(_two_wire)
+   	delayMicroseconds ( SR_WAIT_2W_US );
    else
-   	delayMicroseconds ( 17 ); // 3 wire mode is faster so it must delay longer
+   	delayMicroseconds ( SR_WAIT_3W_US ); // 3 wire mode is faster so it must delay longer
 #else
    delayMicroseconds ( 37 );      // commands & data writes need > 37us to complete
 #endif
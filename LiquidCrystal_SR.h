@@ -55,6 +55,12 @@
 // - defining the same pin for Enable as for Data in constructor
 // - by using the token TWO_WIRE for the enable pin.
 //
+// In 3 wire mode the shift register can be loaded through the SPI peripheral
+// by passing HW_SPI as the data and clock pins: Data goes to MOSI, Clock to
+// SCK and the Enable (latch) pin to any digital IO. Two wire mode can't be
+// used with HW_SPI since the data line can't be driven as the enable signal.
+// The sketch has to include <SPI.h>, see FIO_HW_SPI.
+//
 // Data and Clock outputs/pins goes to the shiftregister.
 // LCD RW-pin hardwired to LOW (only writing to LCD).
 // Busy Flag (BF, data bit D7) is not read.
@@ -95,6 +101,7 @@
 #include <inttypes.h>
 #include "LCD.h"
 #include "FastIO.h"
+#include "FastPin.h"
 
 
 // two-wire indicator constant
@@ -103,6 +110,10 @@
 #define SR_RS_BIT 0x04
 #define SR_EN_BIT 0x80
 
+// _spi values: shift register loaded through SPI, with or without a latch pin
+#define SR_SPI          1
+#define SR_SPI_NO_LATCH 2
+
 class LiquidCrystal_SR : public LCD
 {
 public:
@@ -113,12 +124,26 @@ public:
     The constructor does not initialize the LCD. Assuming 1 line 8 pixel high 
     font.
     
-    @param srdata[in]   pin for shiftregister data line.
-    @param srclock[in]  pin for shiftregister clock line.
-    @param enable[in]   optional direct enable pin for the LCD
+    @param srdata[in]   pin for shiftregister data line, HW_SPI for MOSI.
+    @param srclock[in]  pin for shiftregister clock line, HW_SPI for SCK.
+    @param enable[in]   optional direct enable pin for the LCD, required
+    with HW_SPI (the register latch pin): with TWO_WIRE or HW_SPI the
+    display isn't driven.
     */
    LiquidCrystal_SR ( uint8_t srdata, uint8_t srclock, uint8_t enable=TWO_WIRE );
    
+   /*!
+    @function
+    @abstract   LCD initialization.
+    @discussion Initializes the SPI peripheral when the shift register is
+    loaded through it (HW_SPI) and then the LCD.
+    
+    @param      cols[in] the number of columns that the display has
+    @param      rows[in] the number of rows that the display has
+    @param      charsize[in] character size, default==LCD_5x8DOTS
+    */
+   virtual void begin(uint8_t cols, uint8_t rows, uint8_t charsize = LCD_5x8DOTS);
+   
    /*!
     @function
     @abstract   Send a particular value to the LCD.
@@ -156,6 +181,14 @@ public:
     */
    void setBacklight ( uint8_t mode );
    
+protected:
+   
+   /*!
+    * @method
+    * @abstract takes care of shifting and the enable pulse
+    */
+   virtual void shiftIt (uint8_t val);
+   
 private:
    
    /*!
@@ -166,14 +199,9 @@ private:
    void init ( uint8_t srdata, uint8_t srclock, uint8_t enable, uint8_t lines, 
               uint8_t font );
    
-   /*!
-    * @method
-    * @abstract takes care of shifting and the enable pulse
-    */
-   void shiftIt (uint8_t val);
-   
    uint8_t _enable_pin;  // Enable Pin
    uint8_t _two_wire;    // two wire mode
+   uint8_t _spi;         // shift register loaded through SPI
    
    fio_register _srDataRegister; // Serial Data pin
    fio_bit _srDataBit;
@@ -184,5 +212,77 @@ private:
    
 };
 
+// Waits of the base class after each send on cores up to 16MHz, its fio
+// loads (~25 cycles per bit on AVR) make up the rest of the 37us execution
+// time in 2 wire and 3 wire mode.
+#define SR_WAIT_2W_US 10
+#define SR_WAIT_3W_US 17
+
+// Wait between two sends of the compile time pin variant on cores up to
+// 16MHz. The HD44780 needs 37us after the last enable pulse of a command
+// (270kHz clock, 40us at 250kHz). Its unrolled loads are not counted, at 9
+// cycles per bit they only add ~6.5us of margin per 2 wire nibble (4.5us in
+// 3 wire mode) at 16MHz, so it tops up the base class wait to 40us.
+#if (F_CPU <= 16000000)
+#define SR_FAST_EXEC_US 40
+#else
+#define SR_FAST_EXEC_US 0
+#endif
+
+/*!
+ @class
+ @abstract   LiquidCrystal_SR with the shift register pins fixed at compile
+ time.
+ @discussion Same wiring and behaviour as LiquidCrystal_SR, the shift register
+ is loaded through FastPin and the unrolled fio_shiftOut<>(). HW_SPI is not
+ supported, use LiquidCrystal_SR for it.
+ 
+ LiquidCrystal_SR_Fast<8, 7, TWO_WIRE> lcd;
+ */
+template <uint8_t SRDATA, uint8_t SRCLOCK, uint8_t ENABLE = TWO_WIRE>
+class LiquidCrystal_SR_Fast : public LiquidCrystal_SR
+{
+public:
+   LiquidCrystal_SR_Fast ( ) : LiquidCrystal_SR ( SRDATA, SRCLOCK, ENABLE )
+   {
+      FastPin<SRDATA>::begin ( );
+      FastPin<SRCLOCK>::begin ( );
+      FastPin<EN_PIN>::begin ( );
+   }
+   
+   virtual void send(uint8_t value, uint8_t mode)
+   {
+      LiquidCrystal_SR::send ( value, mode );
+      if ( SR_FAST_EXEC_US )
+      {
+         delayMicroseconds ( SR_FAST_EXEC_US - ( TWO_WIRE_MODE ?
+                                                 SR_WAIT_2W_US : SR_WAIT_3W_US ) );
+      }
+   }
+   
+protected:
+   virtual void shiftIt (uint8_t val)
+   {
+      if ( TWO_WIRE_MODE )
+      {
+         // Clear to get Enable LOW
+         fio_shiftOut< FastPin<SRDATA>, FastPin<SRCLOCK> > ( );
+      }
+      fio_shiftOut< FastPin<SRDATA>, FastPin<SRCLOCK> > ( val, MSBFIRST );
+      
+      FastPin<EN_PIN>::high ( );
+      delayMicroseconds (1);         // enable pulse must be >450ns
+      FastPin<EN_PIN>::low ( );
+   }
+   
+private:
+   // Enable on the data line, as the base class: TWO_WIRE or ENABLE == SRDATA
+   enum
+   {
+      TWO_WIRE_MODE = ( ( ENABLE == TWO_WIRE ) || ( ENABLE == SRDATA ) ),
+      EN_PIN        = TWO_WIRE_MODE ? SRDATA : ENABLE
+   };
+};
+
 #endif
 
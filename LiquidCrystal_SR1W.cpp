@@ -44,9 +44,58 @@
 // @author  S. Erisman - arduino@serisman.com
 // ---------------------------------------------------------------------------
 
-#if defined (__AVR__)
+#include "FastIO.h"
+
+#if !defined (FIO_FALLBACK)
 #include "LiquidCrystal_SR1W.h"
 
+// Quick clock edges, each one a single store
+// ---------------------------------------------------------------------------
+#if defined (FIO_OUTSET) || defined (FIO_BSRR)
+// Set/clear registers, nothing to pre-calculate
+#define SR1W_EDGES_BEGIN()
+#define SR1W_EDGE_HIGH()	fio_digitalWrite_HIGH(srRegister, srMask)
+#define SR1W_EDGE_LOW()		fio_digitalWrite_LOW(srRegister, srMask)
+#else
+// Pre-calculate the port values to make sure the clock pulse is as quick as possible
+#define SR1W_EDGES_BEGIN()	fio_bit reg_val = *srRegister; \
+							fio_bit bit_low = reg_val & ~srMask; \
+							fio_bit bit_high = reg_val | srMask
+#define SR1W_EDGE_HIGH()	*srRegister = bit_high
+#define SR1W_EDGE_LOW()		*srRegister = bit_low
+#endif
+
+// Register data lines of every nibble, built at compile time from the masks
+// ---------------------------------------------------------------------------
+#define SR1W_NIBBLE(n)	( ( ((n) & 0x01) ? SR1W_D4_MASK : 0 ) | \
+						  ( ((n) & 0x02) ? SR1W_D5_MASK : 0 ) | \
+						  ( ((n) & 0x04) ? SR1W_D6_MASK : 0 ) | \
+						  ( ((n) & 0x08) ? SR1W_D7_MASK : 0 ) )
+
+static const uint8_t sr1wNibble[16] PROGMEM =
+{
+	SR1W_NIBBLE(0x0), SR1W_NIBBLE(0x1), SR1W_NIBBLE(0x2), SR1W_NIBBLE(0x3),
+	SR1W_NIBBLE(0x4), SR1W_NIBBLE(0x5), SR1W_NIBBLE(0x6), SR1W_NIBBLE(0x7),
+	SR1W_NIBBLE(0x8), SR1W_NIBBLE(0x9), SR1W_NIBBLE(0xA), SR1W_NIBBLE(0xB),
+	SR1W_NIBBLE(0xC), SR1W_NIBBLE(0xD), SR1W_NIBBLE(0xE), SR1W_NIBBLE(0xF)
+};
+
+// calibrate() probe loads, in pairs forming whole bytes so the LCD stays in
+// step: the data bytes 0x5A and 0xA5 and two NOP commands (0x00). RS and the
+// data lines alternate, and in the data bytes D7, shifted in just before QA,
+// has the other level than QA, so a bit lost or doubled by the RC timing
+// shows on QA.
+// ---------------------------------------------------------------------------
+#define SR1W_PROBE(rs, n, qa)	( (rs) | SR1W_NIBBLE(n) | ( (qa) ? SR1W_UNUSED_MASK : 0 ) )
+
+static const uint8_t sr1wProbes[8] PROGMEM =
+{
+	SR1W_PROBE(SR1W_RS_MASK, 0x5, 1), SR1W_PROBE(SR1W_RS_MASK, 0xA, 0),
+	SR1W_PROBE(SR1W_RS_MASK, 0xA, 0), SR1W_PROBE(SR1W_RS_MASK, 0x5, 1),
+	SR1W_PROBE(0, 0x0, 1),            SR1W_PROBE(0, 0x0, 0),
+	SR1W_PROBE(0, 0x0, 0),            SR1W_PROBE(0, 0x0, 1)
+};
+
 // CONSTRUCTORS
 // ---------------------------------------------------------------------------
 // Assuming 1 line 8 pixel high font
@@ -69,6 +118,10 @@ void LiquidCrystal_SR1W::init(uint8_t srdata, t_sr1w_circuitType circuitType, t_
    
 	_blPolarity = blpol;
    
+	_delayUs = SR1W_DELAY_US;
+   
+	_spareMask = SR1W_UNUSED_MASK;
+   
 	_displayfunction = LCD_4BITMODE | LCD_1LINE | LCD_5x8DOTS;
    
    clearSR();
@@ -93,25 +146,24 @@ uint8_t LiquidCrystal_SR1W::clearSR()
 	// This also triggers the EN pin because of the falling edge.
 	SR1W_DELAY();
    
-	ATOMIC_BLOCK(ATOMIC_RESTORESTATE)
+	FIO_OP_BLOCK
 	{
-		// Pre-calculate these values for extra performance and to make sure the clock pulse is as quick as possible
-		fio_bit reg_val = *srRegister;
-		fio_bit bit_low = reg_val & ~srMask;
-		fio_bit bit_high = reg_val | srMask;
+		SR1W_EDGES_BEGIN();
       
 		// Clear the shift register (without triggering the Latch/EN pins)
 		// We only need to shift 7 bits here because the subsequent HIGH transistion will also shift a '0' in.
 		for (int8_t i = 6; i>=0; i--)
 		{
 			// Shift in a '0' (NOTE: This clock pulse needs to execute as quickly as possible)
-			*srRegister = bit_high;
-			*srRegister = bit_low;
+			SR1W_EDGE_HIGH();
+			SR1W_PULSE();
+			SR1W_EDGE_LOW();
+			SR1W_PULSE();
 		}
       
 		// Set the Serial PIN to a HIGH state so the next nibble/byte can be loaded
 		// This also shifts the 8th '0' bit in.
-		*srRegister = bit_high;
+		SR1W_EDGE_HIGH();
 	}
    
 	// Give the Data capacitor a chance to fully charge
@@ -134,43 +186,44 @@ uint8_t LiquidCrystal_SR1W::loadSR(uint8_t val)
 	uint8_t previousBit = 1;
    
 	// Send the data to the shift register (MSB first)
-	for (int8_t i = 7; i>=0; i--)
+	FIO_BYTE_BLOCK
 	{
-		if (val & 0x80)
+		for (int8_t i = 7; i>=0; i--)
 		{
-			if (previousBit == 0)
+			if (val & 0x80)
 			{
-				// We need to make sure the Data capacitor has fully recharged
-				SR1W_DELAY();
+				if (previousBit == 0)
+				{
+					// We need to make sure the Data capacitor has fully recharged
+					SR1W_DELAY();
+				}
+            
+				previousBit = 1;
+            
+				FIO_BIT_BLOCK
+				{
+					SR1W_EDGES_BEGIN();
+               
+					// Shift in a '1' (NOTE: This clock pulse needs to execute as quickly as possible)
+					SR1W_EDGE_LOW();
+					SR1W_PULSE();
+					SR1W_EDGE_HIGH();
+				}
 			}
-         
-			previousBit = 1;
-         
-			ATOMIC_BLOCK(ATOMIC_RESTORESTATE)
+			else
 			{
-				// Pre-calculate these values to make sure the clock pulse is as quick as possible
-				fio_bit reg_val = *srRegister;
-				fio_bit bit_low = reg_val & ~srMask;
-				fio_bit bit_high = reg_val | srMask;
+				// Shift in a '0'
+				FIO_BIT_BLOCK { fio_digitalWrite_LOW(srRegister, srMask); }
             
-				// Shift in a '1' (NOTE: This clock pulse needs to execute as quickly as possible)
-				*srRegister = bit_low;
-				*srRegister = bit_high;
+				// We need to make sure the Data capacitor has fully discharged
+				SR1W_DELAY();
+            
+				previousBit = 0;
+            
+				FIO_BIT_BLOCK { fio_digitalWrite_HIGH(srRegister, srMask); }
 			}
+			val <<= 1;
 		}
-		else
-		{
-			// Shift in a '0'
-			SR1W_ATOMIC_WRITE_LOW(srRegister, srMask);
-         
-			// We need to make sure the Data capacitor has fully discharged
-			SR1W_DELAY();
-         
-			previousBit = 0;
-         
-			SR1W_ATOMIC_WRITE_HIGH(srRegister, srMask);
-		}
-		val <<= 1;
 	}
    
 	// NOTE: Serial PIN is currently HIGH
@@ -197,6 +250,34 @@ uint8_t LiquidCrystal_SR1W::loadSR(uint8_t val)
 	return numDelays;
 }
 
+//
+// verify
+uint8_t LiquidCrystal_SR1W::verify ( uint8_t sensePin )
+{
+	// Pairs of nibbles of whole bytes, see sr1wProbes
+	for ( uint8_t i = 0; i < sizeof ( sr1wProbes ); i++ )
+	{
+		uint8_t probe = pgm_read_byte ( &sr1wProbes[i] );
+      
+		loadSR ( SR1W_EN_MASK | _blMask | probe );
+		if ( ( digitalRead ( sensePin ) == HIGH ) != ( ( probe & SR1W_UNUSED_MASK ) != 0 ) )
+		{
+			// Leave the LCD in step: complete the byte if it was the first nibble
+			if ( !( i & 0x01 ) )
+			{
+				loadSR ( SR1W_EN_MASK | _blMask | pgm_read_byte ( &sr1wProbes[i + 1] ) );
+			}
+			delayMicroseconds ( 40 );
+			return 0;
+		}
+		if ( i & 0x01 )
+		{
+			delayMicroseconds ( 40 );
+		}
+	}
+	return 1;
+}
+
 // PUBLIC METHODS
 // ---------------------------------------------------------------------------
 
@@ -208,37 +289,22 @@ void LiquidCrystal_SR1W::send(uint8_t value, uint8_t mode)
 {
 	uint8_t numDelays = 0;
    
-	uint8_t data;
+	// Control lines are the same for both nibbles
+	uint8_t control = ( mode == LCD_DATA ) ? SR1W_RS_MASK : 0;
+	control |= SR1W_EN_MASK | _spareMask;
+	control |= _blMask;
    
 	if ( mode != FOUR_BITS )
 	{
 		// upper nibble
-		data = ( mode == LCD_DATA ) ? SR1W_RS_MASK : 0;
-		data |= SR1W_EN_MASK | SR1W_UNUSED_MASK;
-		data |= _blMask;
-      
-		if (value & _BV(4))	data |= SR1W_D4_MASK;
-		if (value & _BV(5)) data |= SR1W_D5_MASK;
-		if (value & _BV(6)) data |= SR1W_D6_MASK;
-		if (value & _BV(7)) data |= SR1W_D7_MASK;
-      
-		numDelays += loadSR(data);
+		numDelays += loadSR(control | pgm_read_byte(&sr1wNibble[value >> 4]));
 	}
    
 	// lower nibble
-	data = ( mode == LCD_DATA ) ? SR1W_RS_MASK : 0;
-	data |= SR1W_EN_MASK | SR1W_UNUSED_MASK;
-	data |= _blMask;
-   
-	if (value & _BV(0))	data |= SR1W_D4_MASK;
-	if (value & _BV(1)) data |= SR1W_D5_MASK;
-	if (value & _BV(2)) data |= SR1W_D6_MASK;
-	if (value & _BV(3)) data |= SR1W_D7_MASK;
-   
-	numDelays += loadSR(data);
+	numDelays += loadSR(control | pgm_read_byte(&sr1wNibble[value & 0x0F]));
    
 	// Make sure we wait at least 40 uS between bytes.
-	unsigned int totalDelay = numDelays * SR1W_DELAY_US;
+	unsigned int totalDelay = numDelays * _delayUs;
 	if (totalDelay < 40)
 		delayMicroseconds(40 - totalDelay);
 }
@@ -263,4 +329,58 @@ void LiquidCrystal_SR1W::setBacklight ( uint8_t value )
 	// The seems to be safe because the LCD appears to treat this as a NOP.
 	send(0, COMMAND);
 }
-#endif // defined (__AVR__)
+
+//
+// calibrate
+uint8_t LiquidCrystal_SR1W::calibrate ( uint8_t sensePin )
+{
+	uint8_t found = 0;
+   
+	pinMode ( sensePin, INPUT );
+   
+	if ( verify ( sensePin ) )
+	{
+		// Shorten the delay while the patterns still come through
+		found = _delayUs;
+		while ( _delayUs > SR1W_MIN_DELAY_US )
+		{
+			_delayUs--;
+			if ( !verify ( sensePin ) )
+			{
+				break;
+			}
+			found = _delayUs;
+		}
+	}
+	else
+	{
+		// Slower RC values than the reference circuit
+		while ( _delayUs < SR1W_MAX_DELAY_US )
+		{
+			_delayUs++;
+			if ( verify ( sensePin ) )
+			{
+				found = _delayUs;
+				break;
+			}
+		}
+	}
+   
+	if ( found == 0 )
+	{
+		_delayUs = SR1W_DELAY_US;
+		return 0;
+	}
+   
+	_delayUs = found + SR1W_CAL_MARGIN(found);
+	return _delayUs;
+}
+
+//
+// setDelay
+void LiquidCrystal_SR1W::setDelay ( uint8_t delayUs )
+{
+	_delayUs = ( delayUs < SR1W_MIN_DELAY_US ) ? SR1W_MIN_DELAY_US : delayUs;
+}
+
+#endif // !defined (FIO_FALLBACK)
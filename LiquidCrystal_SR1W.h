@@ -129,7 +129,7 @@
 //
 //
 // Default Shift Register Bits - Shifted MSB first:
-// Bit #0 (QA) - not used
+// Bit #0 (QA) - not used, spare output (gpioWrite) or read back by calibrate()
 // Bit #1 (QB) - connects to LCD data input D7
 // Bit #2 (QC) - connects to LCD data input D6
 // Bit #3 (QD) - connects to LCD data input D5
@@ -273,12 +273,12 @@
 #ifndef _LIQUIDCRYSTAL_SR1W_
 #define _LIQUIDCRYSTAL_SR1W_
 
-#if defined (__AVR__)
-
 #include <inttypes.h>
 #include "LCD.h"
 #include "FastIO.h"
 
+#if !defined (FIO_FALLBACK)
+
 // 1-wire SR timing constants
 // ---------------------------------------------------------------------------
 
@@ -289,7 +289,13 @@
 //	We round this up to a 5uS delay to provide an additional safety margin.
 
 #define SR1W_DELAY_US		5
-#define SR1W_DELAY()		{ delayMicroseconds(SR1W_DELAY_US); numDelays++; }
+#define SR1W_DELAY()		{ delayMicroseconds(_delayUs); numDelays++; }
+
+// calibrate() range and safety margin. The margin covers the drift of the
+// RC values with temperature and supply voltage.
+#define SR1W_MIN_DELAY_US	1
+#define SR1W_MAX_DELAY_US	20
+#define SR1W_CAL_MARGIN(us)	((us) / 4 + 1)
 
 // 1-wire SR output bit constants
 // ---------------------------------------------------------------------------
@@ -303,8 +309,25 @@
 #define SR1W_RS_MASK		0x40
 #define SR1W_EN_MASK		0x80	// This cannot be changed. It has to be the first thing shifted in.
 
-#define SR1W_ATOMIC_WRITE_LOW(reg, mask)	ATOMIC_BLOCK(ATOMIC_RESTORESTATE) { *reg &= ~mask; }
-#define SR1W_ATOMIC_WRITE_HIGH(reg, mask)	ATOMIC_BLOCK(ATOMIC_RESTORESTATE) { *reg |= mask; }
+// Critical sections follow fio_setAtomic() (see FastIO.h). With FIO_ATOMIC_BYTE
+// interrupts stay disabled while loading a whole byte, the RC delays included.
+#define SR1W_ATOMIC_WRITE_LOW(reg, mask)	FIO_OP_BLOCK { fio_digitalWrite_LOW(reg, mask); }
+#define SR1W_ATOMIC_WRITE_HIGH(reg, mask)	FIO_OP_BLOCK { fio_digitalWrite_HIGH(reg, mask); }
+
+// Minimum width of the quick clock pulses. The 74HC595 needs ~20nS at 5V
+// (~100nS at 2V), an AVR store is already longer than that. Faster cores
+// stretch the pulse to 100nS, with the cycle counter on the ESP32 and a
+// short busy loop on the Cortex-M0+ (SAMD21, RP2040) which have none.
+#if defined (__AVR__)
+#define SR1W_PULSE()
+#elif defined (ARDUINO_ARCH_ESP32)
+#define SR1W_PULSE_CYCLES	(F_CPU / 10000000UL)
+#define SR1W_PULSE()		{ uint32_t t0 = ESP.getCycleCount(); \
+                             while ( ESP.getCycleCount() - t0 < SR1W_PULSE_CYCLES ); }
+#else
+#define SR1W_PULSE_LOOPS	(F_CPU / 40000000UL + 1)
+#define SR1W_PULSE()		{ for ( volatile uint8_t n = SR1W_PULSE_LOOPS; n; n-- ); }
+#endif
 
 
 typedef enum { SW_CLEAR, HW_CLEAR } t_sr1w_circuitType;
@@ -352,6 +375,61 @@ public:
     */
    void setBacklight ( uint8_t mode );
    
+   /*!
+    @function
+    @abstract   Finds the shortest reliable RC delay for the installed circuit.
+    @discussion Loads test patterns that vary RS, the data lines and the
+    unused QA output and reads QA back through sensePin. In the data bytes
+    D7, shifted in just before QA, has the other level, so a bit mangled by
+    the RC timing shows on QA. The delay is shortened from
+    SR1W_DELAY_US while the patterns come back right (lengthened up to
+    SR1W_MAX_DELAY_US if the default fails), and a safety margin is added to
+    the shortest one that worked. The LCD receives NOP commands and two
+    data bytes, written at the cursor.
+    
+    Call it before begin(), which clears the data written, since a failed
+    pattern could reach the LCD as a random command, and store the result
+    (getDelay()) to restore it with setDelay() on the next start up.
+    
+    @param      sensePin[in] Arduino pin wired to the QA output.
+    @result     delay in use in uS, 0 if no pattern came back (the delay is
+    left at SR1W_DELAY_US).
+    */
+   uint8_t calibrate ( uint8_t sensePin );
+   
+   /*!
+    @function
+    @abstract   Sets the RC delay.
+    @param      delayUs[in] delay in uS, default SR1W_DELAY_US.
+    */
+   void setDelay ( uint8_t delayUs );
+   
+   /*!
+    @function
+    @abstract   RC delay in use.
+    @result     delay in uS.
+    */
+   uint8_t getDelay ( ) { return _delayUs; }
+   
+   /*!
+    @function
+    @abstract   Sets the spare QA output.
+    @discussion QA is latched with the LCD lines, so it can drive a LED or a
+    relay. The new level is merged into the next LCD write, gpioFlush() loads
+    it straight away. Left HIGH by default, a HIGH bit is quicker to shift in.
+    It can't be used while calibrate() reads QA back.
+    
+    @param      value[in] LOW or HIGH.
+    */
+   void gpioWrite ( uint8_t value ) { _spareMask = value ? SR1W_UNUSED_MASK : 0; }
+   
+   /*!
+    @function
+    @abstract   Loads the spare output.
+    @discussion Sends a NOP command, as setBacklight() does.
+    */
+   void gpioFlush ( ) { send ( 0, COMMAND ); }
+   
 private:
    
    /*!
@@ -375,6 +453,13 @@ private:
     */
    uint8_t loadSR (uint8_t val);
    
+   /*!
+    * @method
+    * @abstract loads the calibration patterns with the current delay
+    * @result 1 if all of them were read back from QA
+    */
+   uint8_t verify (uint8_t sensePin);
+   
    fio_register _srRegister; // Serial PIN
    fio_bit _srMask;
    
@@ -382,10 +467,12 @@ private:
    
    uint8_t _blPolarity;
    uint8_t _blMask;
+   uint8_t _delayUs;     // RC charge/discharge delay
+   uint8_t _spareMask;   // QA level set by gpioWrite
 };
 
 #else
-#error "ONLY SUPPORTED ON AVR PROCESSORS"
-#endif // defined (__AVR__)
+#error "LiquidCrystal_SR1W NEEDS A FASTIO BACKEND (AVR, PIC32, SAMD, ESP32, RP2040, STM32)"
+#endif // !defined (FIO_FALLBACK)
 
 #endif
@@ -84,7 +84,7 @@ void LiquidCrystal_SR2W::loadSR(uint8_t val)
    
  	
 	// strobe LCD enable which can now be toggled by the data line
-	ATOMIC_BLOCK(ATOMIC_RESTORESTATE)
+	FIO_OP_BLOCK
 	{
 		fio_digitalWrite_HIGH(_srDataRegister, _srDataMask);
 		waitUsec (1);         // enable pulse must be >450ns               
@@ -118,7 +118,7 @@ void LiquidCrystal_SR2W::send(uint8_t value, uint8_t mode)
 	 * even on slower AVRs.
 	 */
 #if (F_CPU <= 16000000)
-	delayMicroseconds ( 10 );      // commands & data writes need > 37us to complete
+	delayMicroseconds ( SR2W_WAIT_US ); // commands & data writes need > 37us to complete
 #else
 	delayMicroseconds ( 37 );      // commands & data writes need > 37us to complete
 #endif
@@ -136,6 +136,7 @@
 #include <inttypes.h>
 #include "LCD.h"
 #include "FastIO.h"
+#include "FastPin.h"
 
 
 // two-wire SR output bit constants
@@ -188,6 +189,14 @@ public:
     */
    void setBacklight ( uint8_t mode );
    
+protected:
+   
+   /*!
+    * @method
+    * @abstract takes care of shifting and the enable pulse
+    */
+   virtual void loadSR (uint8_t val);
+   
 private:
    
    /*!
@@ -197,12 +206,6 @@ private:
     */
    void init ( uint8_t srdata, uint8_t srclock, t_backlightPol blpol, uint8_t lines, uint8_t font );
    
-   /*!
-    * @method
-    * @abstract takes care of shifting and the enable pulse
-    */
-   void loadSR (uint8_t val);
-   
    fio_register _srDataRegister; // Serial Data pin
    fio_bit _srDataMask;
    fio_register _srClockRegister; // Clock Pin
@@ -211,4 +214,62 @@ private:
    uint8_t _blPolarity;
    uint8_t _blMask;
 };
+
+// Wait of the base class after each send on cores up to 16MHz, its two fio
+// loads per nibble make up the rest of the 37us execution time.
+#define SR2W_WAIT_US 10
+
+// Wait between two sends of the compile time pin variant on cores up to
+// 16MHz. The HD44780 needs 37us after the last enable pulse of a command
+// (270kHz clock, 40us at 250kHz). Its unrolled loads are not counted, at 9
+// cycles per bit they only add ~6.5us of margin per nibble at 16MHz, so it
+// tops up the base class wait to 40us.
+#if (F_CPU <= 16000000)
+#define SR2W_FAST_EXEC_US 40
+#else
+#define SR2W_FAST_EXEC_US 0
+#endif
+
+/*!
+ @class
+ @abstract   LiquidCrystal_SR2W with the shift register pins fixed at compile
+ time.
+ @discussion Same wiring and behaviour as LiquidCrystal_SR2W, the shift
+ register is loaded through FastPin and the unrolled fio_shiftOut<>().
+ 
+ LiquidCrystal_SR2W_Fast<8, 7> lcd;
+ */
+template <uint8_t SRDATA, uint8_t SRCLOCK>
+class LiquidCrystal_SR2W_Fast : public LiquidCrystal_SR2W
+{
+public:
+   LiquidCrystal_SR2W_Fast ( t_backlightPol blpol = POSITIVE ) :
+      LiquidCrystal_SR2W ( SRDATA, SRCLOCK, blpol )
+   {
+      FastPin<SRDATA>::begin ( );
+      FastPin<SRCLOCK>::begin ( );
+   }
+   
+   virtual void send(uint8_t value, uint8_t mode)
+   {
+      LiquidCrystal_SR2W::send ( value, mode );
+      if ( SR2W_FAST_EXEC_US )
+      {
+         delayMicroseconds ( SR2W_FAST_EXEC_US - SR2W_WAIT_US );
+      }
+   }
+   
+protected:
+   virtual void loadSR (uint8_t val)
+   {
+      // Clear to keep Enable LOW while clocking in new bits
+      fio_shiftOut< FastPin<SRDATA>, FastPin<SRCLOCK> > ( );
+      fio_shiftOut< FastPin<SRDATA>, FastPin<SRCLOCK> > ( val, MSBFIRST );
+      
+      // strobe LCD enable which can now be toggled by the data line
+      FastPin<SRDATA>::high ( );
+      delayMicroseconds (1);         // enable pulse must be >450ns
+      FastPin<SRDATA>::low ( );
+   }
+};
 #endif
@@ -92,6 +92,9 @@
 #include "LiquidCrystal_SR3W.h"
 
 #include "FastIO.h"
+#ifdef FIO_HW_SPI
+#include <SPI.h>
+#endif
 
 /*!
  @defined 
@@ -105,7 +108,7 @@
  @abstract   LCD_BACKLIGHT
  @discussion BACKLIGHT MASK used when backlight is on
  */
-#define LCD_BACKLIGHT   0xFF
+#define LCD_BACKLIGHT   0xFFFF
 
 
 // Default library configuration parameters used by class constructor with
@@ -173,32 +176,95 @@ LiquidCrystal_SR3W::LiquidCrystal_SR3W(uint8_t data, uint8_t clk, uint8_t strobe
    setBacklightPin(backlighPin, pol);
 }
 
+// Cascaded registers, LCD in 8 bit mode
+LiquidCrystal_SR3W::LiquidCrystal_SR3W(uint8_t data, uint8_t clk, uint8_t strobe,
+                                       uint8_t En, uint8_t Rw, uint8_t Rs, 
+                                       uint8_t d0, uint8_t d1, uint8_t d2, uint8_t d3,
+                                       uint8_t d4, uint8_t d5, uint8_t d6, uint8_t d7 )
+{
+   init( data, clk, strobe, Rs, Rw, En, d4, d5, d6, d7 );
+   initCascade( d0, d1, d2, d3, d4, d5, d6, d7 );
+}
+
+LiquidCrystal_SR3W::LiquidCrystal_SR3W(uint8_t data, uint8_t clk, uint8_t strobe,
+                                       uint8_t En, uint8_t Rw, uint8_t Rs, 
+                                       uint8_t d0, uint8_t d1, uint8_t d2, uint8_t d3,
+                                       uint8_t d4, uint8_t d5, uint8_t d6, uint8_t d7,
+                                       uint8_t backlighPin, t_backlightPol pol)
+{
+   init( data, clk, strobe, Rs, Rw, En, d4, d5, d6, d7 );
+   initCascade( d0, d1, d2, d3, d4, d5, d6, d7 );
+   setBacklightPin(backlighPin, pol);
+}
+
+
+void LiquidCrystal_SR3W::begin(uint8_t cols, uint8_t lines, uint8_t dotsize)
+{
+   if ( _spi )
+   {
+#ifdef FIO_HW_SPI
+      SPI.begin();
+#ifndef SPI_HAS_TRANSACTION
+      SPI.setBitOrder(MSBFIRST);
+      SPI.setDataMode(SPI_MODE0);
+      SPI.setClockDivider(SPI_CLOCK_DIV2);
+#endif
+#endif
+      _spiReady = 1;
+      loadSR( _backlightStsMask | _gpio );  // Latch the current backlight status
+   }
+   LCD::begin ( cols, lines, dotsize );
+}
+
 
 void LiquidCrystal_SR3W::send(uint8_t value, uint8_t mode)
 {
    
-   if ( mode != FOUR_BITS )
+   if ( _cascaded )
    {
-      write4bits( (value >> 4), mode ); // upper nibble
-   }   
-   write4bits( (value & 0x0F), mode); // lower nibble
-
+      writeNbits( value, 8, mode );     // whole byte
+   }
+   else
+   {
+      if ( mode != FOUR_BITS )
+      {
+         writeNbits( (value >> 4), 4, mode ); // upper nibble
+      }   
+      writeNbits( (value & 0x0F), 4, mode); // lower nibble
+   }
 
+   if ( _strobeEn )
+   {
+      // The next load is the next command, see SR3W_WAIT_STROBE_US
+      delayMicroseconds ( SR3W_WAIT_STROBE_US );
+   }
+   else if ( _spi )
+   {
+      // The SPI peripheral loads the register well within the LCD command
+      // execution time, so always wait for it.
+      delayMicroseconds ( 37 );      // commands & data writes need > 37us to complete
+   }
+   else
+   {
 #if (F_CPU <= 16000000)
-   // No need to use the delay routines on AVR since the time taken to write
-   // on AVR with SR pin mapping even with fio is longer than LCD command execution.
-   waitUsec(37); //goes away on AVRs
+      // No need to use the delay routines on AVR since the time taken to write
+      // on AVR with SR pin mapping even with fio is longer than LCD command execution.
+      // Cascaded registers with E on an output shift the same 32 bits per
+      // character.
+      waitUsec(37); //goes away on AVRs
 #else
-   delayMicroseconds ( 37 );      // commands & data writes need > 37us to complete
+      delayMicroseconds ( 37 );      // commands & data writes need > 37us to complete
 #endif
+   }
 
 }
 
 
 void LiquidCrystal_SR3W::setBacklightPin ( uint8_t value, t_backlightPol pol = POSITIVE )
 {
-   _backlightPinMask = ( 1 << value );
+   _backlightPinMask = ( (uint16_t)1 << value );
    _backlightStsMask = LCD_NOBACKLIGHT;
+   _gpio &= ~_backlightPinMask;
    _polarity = pol;
    setBacklight (BACKLIGHT_OFF);     // Set backlight to off as initial setup
 }
@@ -220,10 +286,54 @@ void LiquidCrystal_SR3W::setBacklight ( uint8_t value )
       {
          _backlightStsMask = _backlightPinMask & LCD_NOBACKLIGHT;
       }
-      loadSR( _backlightStsMask );
+      loadSR( _backlightStsMask | _gpio );
    }
 }
 
+void LiquidCrystal_SR3W::setEnable2Pin ( uint8_t value )
+{
+   // The strobe line can only be the enable of one controller
+   if ( _strobeEn )
+   {
+      return;
+   }
+   _En2 = ( (uint16_t)1 << value );
+   _gpio &= ~_En2;
+   _controllers = 2;
+}
+
+void LiquidCrystal_SR3W::gpioWrite ( uint8_t pin, uint8_t value )
+{
+   uint16_t mask;
+   
+   // Outputs driving the LCD are left alone
+   // ----------------------------------------------------
+   if ( pin >= ( _cascaded ? 16 : 8 ) )
+   {
+      return;
+   }
+   mask = ( (uint16_t)1 << pin );
+   if ( mask & ( _En | _En2 | _Rs | _backlightPinMask | _nibbleMap[0][0x0F] |
+                 ( _cascaded ? _nibbleMap[1][0x0F] : 0 ) ) )
+   {
+      return;
+   }
+   
+   if ( value )
+   {
+      _gpio |= mask;
+   }
+   else
+   {
+      _gpio &= ~mask;
+   }
+}
+
+void LiquidCrystal_SR3W::gpioFlush ( )
+{
+   loadSR( _backlightStsMask | _gpio );
+}
+
 
 // PRIVATE METHODS
 // -----------------------------------------------------------------------------
@@ -232,67 +342,132 @@ int LiquidCrystal_SR3W::init(uint8_t data, uint8_t clk, uint8_t strobe,
                              uint8_t Rs, uint8_t Rw, uint8_t En,
                              uint8_t d4, uint8_t d5, uint8_t d6, uint8_t d7)
 {
-   _data       = fio_pinToBit(data);
-   _clk        = fio_pinToBit(clk);
+   // Data and clock are driven by the SPI peripheral when HW_SPI is used,
+   // it is initialised in begin().
+   _spi        = ( data == HW_SPI );
+   _spiReady   = 0;
+   _cascaded   = 0;
+   _strobeEn   = 0;
+   if ( !_spi )
+   {
+      _data       = fio_pinToBit(data);
+      _clk        = fio_pinToBit(clk);
+      _data_reg   = fio_pinToOutputRegister(data);
+      _clk_reg    = fio_pinToOutputRegister(clk);
+   }
    _strobe     = fio_pinToBit(strobe);
-   _data_reg   = fio_pinToOutputRegister(data);
-   _clk_reg    = fio_pinToOutputRegister(clk);
    _strobe_reg = fio_pinToOutputRegister(strobe);
    
    // LCD pin mapping
    _backlightPinMask = 0;
    _backlightStsMask = LCD_NOBACKLIGHT;
    _polarity = POSITIVE;
+   _gpio = 0;
    
-   _En = ( 1 << En );
-   _Rw = ( 1 << Rw );
-   _Rs = ( 1 << Rs );
+   _En = ( En == SR3W_STROBE_EN ) ? 0 : ( (uint16_t)1 << En );
+   _En2 = 0;
+   _Rw = ( (uint16_t)1 << Rw );
+   _Rs = ( (uint16_t)1 << Rs );
    
    // Initialise pin mapping
-   _data_pins[0] = ( 1 << d4 );
-   _data_pins[1] = ( 1 << d5 );
-   _data_pins[2] = ( 1 << d6 );
-   _data_pins[3] = ( 1 << d7 );
+   mapNibbles ( _nibbleMap[0], d4, d5, d6, d7 );
    
    _displayfunction = LCD_4BITMODE | LCD_1LINE | LCD_5x8DOTS;
    
    return (1);
 }
 
-void LiquidCrystal_SR3W::write4bits(uint8_t value, uint8_t mode)
+void LiquidCrystal_SR3W::initCascade(uint8_t d0, uint8_t d1, uint8_t d2, uint8_t d3,
+                                     uint8_t d4, uint8_t d5, uint8_t d6, uint8_t d7)
 {
-   uint8_t pinMapValue = 0;
+   _cascaded = 1;
+   _strobeEn = ( _En == 0 );
+   
+   mapNibbles ( _nibbleMap[0], d0, d1, d2, d3 );  // low nibble
+   mapNibbles ( _nibbleMap[1], d4, d5, d6, d7 );  // high nibble
    
+   _displayfunction = LCD_8BITMODE | LCD_1LINE | LCD_5x8DOTS;
+}
+
+void LiquidCrystal_SR3W::writeNbits(uint8_t value, uint8_t numBits, uint8_t mode)
+{
    // Map the value to LCD pin mapping
    // --------------------------------
-   for ( uint8_t i = 0; i < 4; i++ )
+   uint16_t pinMapValue = _nibbleMap[0][value & 0x0F];
+   if ( numBits > 4 )
    {
-      if ( ( value & 0x1 ) == 1 )
-      {
-         pinMapValue |= _data_pins[i];
-      }
-      value = ( value >> 1 );
+      pinMapValue |= _nibbleMap[1][value >> 4];
    }
    
    // Is it a command or data
    // -----------------------
-   mode = ( mode == LCD_DATA ) ? _Rs : 0;
+   if ( mode == LCD_DATA )
+   {
+      pinMapValue |= _Rs;
+   }
+   
+   pinMapValue |= _backlightStsMask | _gpio;
    
-   pinMapValue |= mode | _backlightStsMask;
-   loadSR ( pinMapValue | _En );  // Send with enable high
+   // Enable lines of the addressed controllers
+   // -----------------------
+   uint16_t enable = ( _controller & LCD_CONTROLLER_1 ) ? _En : 0;
+   if ( _controller & LCD_CONTROLLER_2 )
+   {
+      enable |= _En2;
+   }
+   
+   if ( _strobeEn )
+   {
+      loadSR ( pinMapValue );  // The strobe pulses enable
+      return;
+   }
+   
+   loadSR ( pinMapValue | enable );  // Send with enable high
    loadSR ( pinMapValue); // Send with enable low
 }
 
 
-void LiquidCrystal_SR3W::loadSR(uint8_t value) 
+void LiquidCrystal_SR3W::loadSR(uint16_t value) 
 {
    // Load the shift register with information
-   fio_shiftOut(_data_reg, _data, _clk_reg, _clk, value, MSBFIRST);
+   if ( _spi )
+   {
+      // Nothing can be sent until begin() has started the SPI peripheral
+      if ( !_spiReady )
+      {
+         return;
+      }
+#ifdef FIO_HW_SPI
+#ifdef SPI_HAS_TRANSACTION
+      SPI.beginTransaction ( SPISettings ( SR_SPI_CLOCK, MSBFIRST, SPI_MODE0 ) );
+#endif
+      if ( _cascaded )
+      {
+         SPI.transfer ( (uint8_t)( value >> 8 ) );
+      }
+      SPI.transfer ( (uint8_t)value );
+#ifdef SPI_HAS_TRANSACTION
+      SPI.endTransaction ( );
+#endif
+#endif
+   }
+   else
+   {
+      if ( _cascaded )
+      {
+         fio_shiftOut(_data_reg, _data, _clk_reg, _clk, (uint8_t)( value >> 8 ), MSBFIRST);
+      }
+      fio_shiftOut(_data_reg, _data, _clk_reg, _clk, (uint8_t)value, MSBFIRST);
+   }
    
    // Strobe the data into the latch
-   ATOMIC_BLOCK(ATOMIC_RESTORESTATE)
+   FIO_OP_BLOCK
    {
       fio_digitalWrite_HIGH(_strobe_reg, _strobe);
+      if ( _strobeEn )
+      {
+         delayMicroseconds (1);      // enable pulse must be >450ns
+      }
       fio_digitalWrite_SWITCHTO(_strobe_reg, _strobe, LOW);
    }
 }
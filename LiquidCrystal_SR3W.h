@@ -61,6 +61,26 @@
 //
 // NOTE: Rw is not used by the driver so it can be connected to GND.
 //
+// The shift register can also be loaded through the SPI peripheral by passing
+// HW_SPI as the data and clock pins: Data connects to MOSI, Clock to SCK and
+// Strobe to any digital IO. Each register load then takes a single SPI byte.
+//
+// Two cascaded registers (QH' of the first into the data input of the second)
+// drive the LCD in 8 bit mode. Outputs are then numbered 0..7 for Qa..Qh of
+// the first register and 8..15 for Qa..Qh of the second. With E on a
+// register output each character is a 16 bit load with E high and one with
+// E low, the same 32 bits and two strobes as four 8 bit loads in 4 bit mode.
+// With E wired to the strobe line instead (En = SR3W_STROBE_EN), as
+// LiquidCrystal_SR does in 3 wire mode, the strobe latches the byte and
+// pulses E: a character is a single 16 bit load and strobe.
+//
+//   +----+-------------+-------------+-----------+
+//   |    Strobe        Data          Clock       |
+//   |   74HC595 #1 (0..7)   QH' -> 74HC595 #2 (8..15)
+//   +----+----+----+----+----+----+----+----+----+
+//   DB0..DB7 on 0..7, E, Rw, RS and backlight on 8..15
+//   (or E on Strobe, Rw and RS and backlight on 8..15)
+//
 // The functionality provided by this class and its base class is identical
 // to the original functionality of the Arduino LiquidCrystal library.
 //
@@ -73,7 +93,18 @@
 #include <inttypes.h>
 #include "LCD.h"
 #include "FastIO.h"
+#include "FastPin.h"
+
 
+/*!
+ @defined
+ @abstract   LCD enable driven by the strobe line.
+ @discussion Passed as En to the cascaded register constructors when the LCD
+ E pin is wired to the strobe line along with the register latches. Only
+ valid with cascaded registers: backlight and spare output loads then reach
+ the LCD as a harmless 0x00 command. There is no second controller enable.
+ */
+#define SR3W_STROBE_EN 0xFF
 
 class LiquidCrystal_SR3W : public LCD 
 {
@@ -96,8 +127,10 @@ public:
        GND                 Rw
     
     @param      strobe[in] digital IO connected to shiftregister strobe pin.
-    @param      data[in] digital IO connected to the shiftregister data pin.
-    @param      clk[in] digital IO connected to the shiftregister clock pin.
+    @param      data[in] digital IO connected to the shiftregister data pin,
+    HW_SPI to use the SPI peripheral (MOSI).
+    @param      clk[in] digital IO connected to the shiftregister clock pin,
+    HW_SPI to use the SPI peripheral (SCK).
     */
    LiquidCrystal_SR3W(uint8_t data, uint8_t clk, uint8_t strobe);
    // Constructor with backlight control
@@ -130,6 +163,45 @@ public:
                       uint8_t d4, uint8_t d5, uint8_t d6, uint8_t d7,
                       uint8_t backlighPin, t_backlightPol pol);
    
+   /*!
+    @method     
+    @abstract   Class constructor for two cascaded shift registers.
+    @discussion Initializes class variables and defines the control lines of
+    the LCD and the 16 bit shift register chain, the LCD is driven in 8 bit
+    mode. The constructor does not initialize the LCD.
+    
+    @param      strobe[in] digital IO connected to shiftregister strobe pin.
+    @param      data[in] digital IO connected to shiftregister data pin.
+    @param      clk[in] digital IO connected to shiftregister clock pin.
+    @param      En[in] LCD En (Enable) pin connected to SR output pin (0..15),
+    SR3W_STROBE_EN if wired to the strobe line.
+    @param      Rw[in] LCD Rw (Read/write) pin connected to SR output pin.
+    @param      Rs[in] LCD Rs (Reg Select) pin connected to SR output pin.
+    @param      d0..d7[in] LCD data 0..7 pins map to the SR output pins.
+    */
+   LiquidCrystal_SR3W(uint8_t data, uint8_t clk, uint8_t strobe, 
+                      uint8_t En, uint8_t Rw, uint8_t Rs, 
+                      uint8_t d0, uint8_t d1, uint8_t d2, uint8_t d3,
+                      uint8_t d4, uint8_t d5, uint8_t d6, uint8_t d7 );
+   // Constructor with backlight control
+   LiquidCrystal_SR3W(uint8_t data, uint8_t clk, uint8_t strobe, 
+                      uint8_t En, uint8_t Rw, uint8_t Rs, 
+                      uint8_t d0, uint8_t d1, uint8_t d2, uint8_t d3,
+                      uint8_t d4, uint8_t d5, uint8_t d6, uint8_t d7,
+                      uint8_t backlighPin, t_backlightPol pol);
+   
+   /*!
+    @function
+    @abstract   LCD initialization.
+    @discussion Initializes the SPI peripheral when the shift register is
+    loaded through it (HW_SPI) and then the LCD.
+    
+    @param      cols[in] the number of columns that the display has
+    @param      rows[in] the number of rows that the display has
+    @param      charsize[in] character size, default==LCD_5x8DOTS
+    */
+   virtual void begin(uint8_t cols, uint8_t rows, uint8_t charsize = LCD_5x8DOTS);
+   
    /*!
     @function
     @abstract   Send a particular value to the LCD.
@@ -151,7 +223,7 @@ public:
     doesn't support dimming backlight capability.
     
     @param      value: pin mapped on the 74HC595N (0, .., 7) for (Qa0, .., Qh7)
-    respectively.
+    respectively, (0, .., 15) with two cascaded registers.
     @param      pol: polarity POSITIVE|NEGATIVE.
     */
    void setBacklightPin ( uint8_t value, t_backlightPol pol );
@@ -167,6 +239,54 @@ public:
     */
    void setBacklight ( uint8_t value );
    
+   /*!
+    @function
+    @abstract   Sets the output driving the second controller enable.
+    @discussion 40x4 displays have a second controller with its own enable
+    pin (E2, rows 2-3), wired to a spare register output. Call it before
+    begin(cols, 4). Not available with SR3W_STROBE_EN.
+    
+    @param      value: register output (0..7), (0..15) with two cascaded
+    registers, connected to E2.
+    */
+   void setEnable2Pin ( uint8_t value );
+   
+   /*!
+    @function
+    @abstract   Sets a spare output of the shift register.
+    @discussion The outputs not wired to E, RS, the data lines or the backlight
+    can drive LEDs or relays. The new level is merged into the next LCD write,
+    gpioFlush() loads it straight away. Outputs set before a flush are loaded
+    together in a single shift. The Rw output can only be used when the LCD Rw
+    pin is tied to GND.
+    
+    @param      pin[in] shift register output (0..7), (0..15) with two cascaded
+    registers.
+    @param      value[in] LOW or HIGH.
+    */
+   void gpioWrite ( uint8_t pin, uint8_t value );
+   
+   /*!
+    @function
+    @abstract   Loads the spare outputs into the shift register.
+    @discussion Single load with E low, the LCD ignores it.
+    */
+   void gpioFlush ( );
+   
+protected:
+   
+   /*!
+    @function
+    @abstract   load into the shift register a byte
+    @discussion loads into the shift register a byte, two bytes (high byte
+    first) with cascaded registers.
+    @param      value[in]: value to be loaded into the shiftregister.
+    */
+   virtual void loadSR(uint16_t value);
+   
+   uint8_t      _cascaded;         // Two cascaded registers, LCD in 8 bit mode
+   uint8_t      _strobeEn;         // LCD enable wired to the strobe line
+   
 private:
    
    /*!
@@ -180,21 +300,23 @@ private:
    
    /*!
     @method     
-    @abstract   Writes an 4 bit value to the LCD.
-    @discussion Writes 4 bits (the least significant) to the LCD control data lines.
-    @param      value[in] Value to write to the LCD
-    @param      more[in]  Value to distinguish between command and data.
-    COMMAND == command, DATA == data.
+    @abstract   Sets up the 8 bit mode with cascaded registers.
+    @discussion Maps the 8 LCD data lines, called after init().
     */
-   void write4bits(uint8_t value, uint8_t mode);
+   void initCascade(uint8_t d0, uint8_t d1, uint8_t d2, uint8_t d3,
+                    uint8_t d4, uint8_t d5, uint8_t d6, uint8_t d7);
    
    /*!
-    @function
-    @abstract   load into the shift register a byte
-    @discussion loads into the shift register a byte
-    @param      value[in]: value to be loaded into the shiftregister.
+    @method     
+    @abstract   Writes an N bit value to the LCD.
+    @discussion Writes numBits bits (the least significant) to the LCD data
+    lines: 4 in 4 bit mode, 8 with cascaded registers.
+    @param      value[in] Value to write to the LCD
+    @param      numBits[in] Number of data lines to write.
+    @param      more[in]  Value to distinguish between command and data.
+    COMMAND == command, DATA == data.
     */
-   void loadSR(uint8_t value);
+   void writeNbits(uint8_t value, uint8_t numBits, uint8_t mode);
    
    
    fio_bit      _strobe;           // shift register strobe pin
@@ -203,13 +325,132 @@ private:
    fio_register _data_reg;         // SR data pin MCU register
    fio_bit      _clk;              // shift register clock pin
    fio_register _clk_reg;          // SR clock pin MCU register
-   uint8_t      _En;               // LCD expander word for enable pin
-   uint8_t      _Rw;               // LCD expander word for R/W pin
-   uint8_t      _Rs;               // LCD expander word for Register Select pin
-   uint8_t      _data_pins[4];     // LCD data lines
-   uint8_t      _backlightPinMask; // Backlight IO pin mask
-   uint8_t      _backlightStsMask; // Backlight status mask
+   uint16_t     _En;               // LCD expander word for enable pin
+   uint16_t     _En2;              // LCD expander word for second controller enable pin
+   uint16_t     _Rw;               // LCD expander word for R/W pin
+   uint16_t     _Rs;               // LCD expander word for Register Select pin
+   uint16_t     _nibbleMap[2][16]; // LCD data lines word of each low/high nibble
+   uint16_t     _backlightPinMask; // Backlight IO pin mask
+   uint16_t     _backlightStsMask; // Backlight status mask
+   uint16_t     _gpio;             // Spare outputs set by gpioWrite
+   uint8_t      _spi;              // Shift register loaded through SPI
+   uint8_t      _spiReady;         // SPI peripheral initialised
+   
+};
+
+// Wait of the base class after each send with E on the strobe line. The
+// strobe ending a load is the enable pulse, only the next load (~25us with
+// fio at 16MHz) separates two commands, so it always waits.
+#define SR3W_WAIT_STROBE_US 37
+
+// Wait between two sends of the compile time pin variant on AVRs up to
+// 16MHz, where the base class otherwise does not wait (FAST_MODE) and relies
+// on its fio loads outlasting the LCD execution time. The HD44780 needs 37us
+// after the last enable pulse of a command (270kHz clock, 40us at 250kHz).
+// Before the next enable pulse comes one load, at 9 cycles per bit ~4.5us
+// per register at 16MHz, not counted here and left as margin. It tops up the
+// base class wait to 40us.
+#if defined(__AVR__) && (F_CPU <= 16000000)
+#define SR3W_FAST_EXEC_US 40
+#else
+#define SR3W_FAST_EXEC_US 0
+#endif
+
+/*!
+ @class
+ @abstract   LiquidCrystal_SR3W with the shift register pins fixed at compile
+ time.
+ @discussion Same wiring, pin mapping and behaviour as LiquidCrystal_SR3W, the
+ shift register is loaded through FastPin and the unrolled fio_shiftOut<>().
+ HW_SPI is not supported, use LiquidCrystal_SR3W for it.
+ 
+ LiquidCrystal_SR3W_Fast<2, 3, 4> lcd;
+ */
+template <uint8_t DATA, uint8_t CLK, uint8_t STROBE>
+class LiquidCrystal_SR3W_Fast : public LiquidCrystal_SR3W
+{
+public:
+   LiquidCrystal_SR3W_Fast ( ) : LiquidCrystal_SR3W ( DATA, CLK, STROBE )
+   {
+      initPins ( );
+   }
+   // Constructor with backlight control
+   LiquidCrystal_SR3W_Fast ( uint8_t backlighPin, t_backlightPol pol ) :
+      LiquidCrystal_SR3W ( DATA, CLK, STROBE, backlighPin, pol )
+   {
+      initPins ( );
+   }
+   // Constructor with LCD pin mapping
+   LiquidCrystal_SR3W_Fast ( uint8_t En, uint8_t Rw, uint8_t Rs,
+                             uint8_t d4, uint8_t d5, uint8_t d6, uint8_t d7 ) :
+      LiquidCrystal_SR3W ( DATA, CLK, STROBE, En, Rw, Rs, d4, d5, d6, d7 )
+   {
+      initPins ( );
+   }
+   // Constructor with LCD pin mapping and backlight control
+   LiquidCrystal_SR3W_Fast ( uint8_t En, uint8_t Rw, uint8_t Rs,
+                             uint8_t d4, uint8_t d5, uint8_t d6, uint8_t d7,
+                             uint8_t backlighPin, t_backlightPol pol ) :
+      LiquidCrystal_SR3W ( DATA, CLK, STROBE, En, Rw, Rs, d4, d5, d6, d7,
+                           backlighPin, pol )
+   {
+      initPins ( );
+   }
+   // Constructor for two cascaded registers, LCD in 8 bit mode
+   LiquidCrystal_SR3W_Fast ( uint8_t En, uint8_t Rw, uint8_t Rs,
+                             uint8_t d0, uint8_t d1, uint8_t d2, uint8_t d3,
+                             uint8_t d4, uint8_t d5, uint8_t d6, uint8_t d7 ) :
+      LiquidCrystal_SR3W ( DATA, CLK, STROBE, En, Rw, Rs,
+                           d0, d1, d2, d3, d4, d5, d6, d7 )
+   {
+      initPins ( );
+   }
+   // Constructor for two cascaded registers with backlight control
+   LiquidCrystal_SR3W_Fast ( uint8_t En, uint8_t Rw, uint8_t Rs,
+                             uint8_t d0, uint8_t d1, uint8_t d2, uint8_t d3,
+                             uint8_t d4, uint8_t d5, uint8_t d6, uint8_t d7,
+                             uint8_t backlighPin, t_backlightPol pol ) :
+      LiquidCrystal_SR3W ( DATA, CLK, STROBE, En, Rw, Rs,
+                           d0, d1, d2, d3, d4, d5, d6, d7, backlighPin, pol )
+   {
+      initPins ( );
+   }
+   
+   virtual void send(uint8_t value, uint8_t mode)
+   {
+      LiquidCrystal_SR3W::send ( value, mode );
+      if ( SR3W_FAST_EXEC_US )
+      {
+         delayMicroseconds ( SR3W_FAST_EXEC_US -
+                             ( _strobeEn ? SR3W_WAIT_STROBE_US : 0 ) );
+      }
+   }
    
+protected:
+   virtual void loadSR(uint16_t value)
+   {
+      if ( _cascaded )
+      {
+         fio_shiftOut< FastPin<DATA>, FastPin<CLK> > ( value >> 8, MSBFIRST );
+      }
+      fio_shiftOut< FastPin<DATA>, FastPin<CLK> > ( value, MSBFIRST );
+      
+      // Strobe the data into the latch
+      FastPin<STROBE>::high ( );
+      if ( _strobeEn )
+      {
+         delayMicroseconds (1);      // enable pulse must be >450ns
+      }
+      FastPin<STROBE>::low ( );
+   }
+   
+private:
+   void initPins ( void )
+   {
+      FastPin<DATA>::begin ( );
+      FastPin<CLK>::begin ( );
+      FastPin<STROBE>::begin ( );
+   }
 };
 
 #endif
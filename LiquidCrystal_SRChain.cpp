@@ -0,0 +1,310 @@
+// ---------------------------------------------------------------------------
+// Copyright (C) - 2026
+//
+//    This program is free software: you can redistribute it and/or modify
+//    it under the terms of the GNU General Public License as published by
+//    the Free Software Foundation, either version 3 of the License, or
+//    any later version.
+//
+//    This program is distributed in the hope that it will be useful,
+//    but WITHOUT ANY WARRANTY; without even the implied warranty of
+//    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//    GNU General Public License for more details.
+//
+//    You should have received a copy of the GNU General Public License v3.0
+//    along with this program.
+//    If not, see <https://www.gnu.org/licenses/gpl-3.0.en.html>.
+//
+// ---------------------------------------------------------------------------
+//
+// Thread Safe: No
+// Extendable: Yes
+//
+// @file LiquidCrystal_SRChain.cpp
+// This file implements a liquid crystal library driving several LCDs from a
+// chain of cascaded latching shift registers, one register per LCD.
+//
+// @brief
+// Each display maps its nibbles to its register of the chain, see
+// LiquidCrystal_SRChain.h for the wiring.
+//
+// @version API 1.0.0
+//
+// ---------------------------------------------------------------------------
+#include <stdio.h>
+#include <string.h>
+#include <inttypes.h>
+
+#if (ARDUINO <  100)
+#include <WProgram.h>
+#else
+#include <Arduino.h>
+#endif
+#include "LiquidCrystal_SRChain.h"
+
+/*!
+ @defined
+ @abstract   LCD_NOBACKLIGHT
+ @discussion No BACKLIGHT MASK
+ */
+#define LCD_NOBACKLIGHT 0x00
+
+/*!
+ @defined
+ @abstract   LCD_BACKLIGHT
+ @discussion BACKLIGHT MASK used when backlight is on
+ */
+#define LCD_BACKLIGHT   0xFF
+
+// Default register to LCD wiring, same as LiquidCrystal_SR3W
+// ---------------------------------------------------------------------------
+#define SRCHAIN_EN 4
+#define SRCHAIN_RW 5
+#define SRCHAIN_RS 6
+#define SRCHAIN_D4 0
+#define SRCHAIN_D5 1
+#define SRCHAIN_D6 2
+#define SRCHAIN_D7 3
+
+// CONSTRUCTORS
+// ---------------------------------------------------------------------------
+LiquidCrystal_SRChain::LiquidCrystal_SRChain ( SRChainIO &chain, uint8_t index )
+{
+   init ( chain, index, SRCHAIN_EN, SRCHAIN_RW, SRCHAIN_RS,
+          SRCHAIN_D4, SRCHAIN_D5, SRCHAIN_D6, SRCHAIN_D7 );
+}
+
+LiquidCrystal_SRChain::LiquidCrystal_SRChain ( SRChainIO &chain, uint8_t index,
+                                               uint8_t backlighPin, t_backlightPol pol )
+{
+   init ( chain, index, SRCHAIN_EN, SRCHAIN_RW, SRCHAIN_RS,
+          SRCHAIN_D4, SRCHAIN_D5, SRCHAIN_D6, SRCHAIN_D7 );
+   setBacklightPin ( backlighPin, pol );
+}
+
+LiquidCrystal_SRChain::LiquidCrystal_SRChain ( SRChainIO &chain, uint8_t index,
+                                               uint8_t En, uint8_t Rw, uint8_t Rs,
+                                               uint8_t d4, uint8_t d5, uint8_t d6, uint8_t d7 )
+{
+   init ( chain, index, En, Rw, Rs, d4, d5, d6, d7 );
+}
+
+LiquidCrystal_SRChain::LiquidCrystal_SRChain ( SRChainIO &chain, uint8_t index,
+                                               uint8_t En, uint8_t Rw, uint8_t Rs,
+                                               uint8_t d4, uint8_t d5, uint8_t d6, uint8_t d7,
+                                               uint8_t backlighPin, t_backlightPol pol )
+{
+   init ( chain, index, En, Rw, Rs, d4, d5, d6, d7 );
+   setBacklightPin ( backlighPin, pol );
+}
+
+// PUBLIC METHODS
+// ---------------------------------------------------------------------------
+
+//
+// begin
+void LiquidCrystal_SRChain::begin(uint8_t cols, uint8_t lines, uint8_t dotsize)
+{
+   _chain->begin ( );
+   LCD::begin ( cols, lines, dotsize );
+
+   // The panels initialized here take the settings of the display
+   if ( _index == SRCHAIN_ALL )
+   {
+      for ( uint8_t i = 0; i < _chain->length ( ); i++ )
+      {
+         LiquidCrystal_SRChain *panel = _chain->_client[i];
+
+         if ( panel != NULL )
+         {
+            panel->_displayfunction = _displayfunction;
+            panel->_displaycontrol  = _displaycontrol;
+            panel->_displaymode     = _displaymode;
+            panel->_numlines        = _numlines;
+            panel->_cols            = _cols;
+            panel->_glyphSet        = _glyphSet;
+         }
+      }
+   }
+}
+
+//
+// send
+void LiquidCrystal_SRChain::send(uint8_t value, uint8_t mode)
+{
+   // Clear and home are followed by a wait in LCD, they can't be deferred
+   uint8_t deferrable = ( mode == LCD_DATA ) ||
+                        ( ( mode == COMMAND ) && ( value > ( LCD_CLEARDISPLAY | LCD_RETURNHOME ) ) );
+
+   if ( _chain->_batch && ( _index != SRCHAIN_ALL ) && deferrable )
+   {
+      if ( _queueCount == SRCHAIN_QUEUE )
+      {
+         _chain->flush ( );
+      }
+      if ( mode == LCD_DATA )
+      {
+         _queueRs |= ( (uint16_t)1 << _queueCount );
+      }
+      _queue[_queueCount++] = value;
+      return;
+   }
+
+   // Anything queued goes out first to keep the order of the writes
+   if ( _chain->_batch )
+   {
+      _chain->flush ( );
+   }
+
+   if ( mode != FOUR_BITS )
+   {
+      write4bits( (value >> 4), mode ); // upper nibble
+   }
+   write4bits( (value & 0x0F), mode); // lower nibble
+
+   delayMicroseconds ( 37 );      // commands & data writes need > 37us to complete
+}
+
+//
+// setBacklightPin
+void LiquidCrystal_SRChain::setBacklightPin ( uint8_t value, t_backlightPol pol = POSITIVE )
+{
+   _backlightPinMask = ( 1 << value );
+   _polarity = pol;
+
+   for ( uint8_t i = 0; i < _chain->length ( ); i++ )
+   {
+      if ( ( _index == SRCHAIN_ALL ) || ( _index == i ) )
+      {
+         _chain->_backlight[i] = _backlightPinMask;
+      }
+   }
+   setBacklight (BACKLIGHT_OFF);     // Set backlight to off as initial setup
+}
+
+//
+// setBacklight
+void LiquidCrystal_SRChain::setBacklight ( uint8_t value )
+{
+   // Check if backlight is available
+   // ----------------------------------------------------
+   if ( _backlightPinMask != 0x0 )
+   {
+      uint8_t status;
+
+      // Check for polarity to configure mask accordingly
+      // ----------------------------------------------------------
+      if  (((_polarity == POSITIVE) && (value > 0)) ||
+           ((_polarity == NEGATIVE ) && ( value == 0 )))
+      {
+         status = _backlightPinMask & LCD_BACKLIGHT;
+      }
+      else
+      {
+         status = _backlightPinMask & LCD_NOBACKLIGHT;
+      }
+
+      for ( uint8_t i = 0; i < _chain->length ( ); i++ )
+      {
+         if ( ( _index == SRCHAIN_ALL ) || ( _index == i ) )
+         {
+            _chain->write ( i, ( _chain->read ( i ) & ~_backlightPinMask ) | status );
+         }
+      }
+      _chain->load ( );
+   }
+}
+
+// PRIVATE METHODS
+// ---------------------------------------------------------------------------
+
+//
+// init
+void LiquidCrystal_SRChain::init ( SRChainIO &chain, uint8_t index,
+                                   uint8_t En, uint8_t Rw, uint8_t Rs,
+                                   uint8_t d4, uint8_t d5, uint8_t d6, uint8_t d7 )
+{
+   _chain = &chain;
+   _index = index;
+
+   // LCD pin mapping
+   _backlightPinMask = 0;
+   _polarity = POSITIVE;
+
+   _En = ( 1 << En );
+   _Rw = ( 1 << Rw );
+   _Rs = ( 1 << Rs );
+
+   mapNibbles ( _nibbleMap, d4, d5, d6, d7 );
+
+   _queueRs    = 0;
+   _queueHead  = 0;
+   _queueCount = 0;
+
+   if ( index < chain.length ( ) )
+   {
+      chain._client[index] = this;
+   }
+
+   _displayfunction = LCD_4BITMODE | LCD_1LINE | LCD_5x8DOTS;
+}
+
+//
+// map
+uint8_t LiquidCrystal_SRChain::map ( uint8_t value, uint8_t mode, uint8_t index )
+{
+   // Map the value to LCD pin mapping, the backlight output unchanged
+   // --------------------------------
+   uint8_t pinMapValue = _nibbleMap[value & 0x0F] |
+                         ( _chain->read ( index ) & _chain->_backlight[index] );
+
+   // Is it a command or data
+   // -----------------------
+   if ( mode == LCD_DATA )
+   {
+      pinMapValue |= _Rs;
+   }
+   return ( pinMapValue );
+}
+
+//
+// write4bits
+void LiquidCrystal_SRChain::write4bits ( uint8_t value, uint8_t mode )
+{
+   for ( uint8_t i = 0; i < _chain->length ( ); i++ )
+   {
+      if ( ( _index == SRCHAIN_ALL ) || ( _index == i ) )
+      {
+         _chain->write ( i, map ( value, mode, i ) | _En );  // Send with enable high
+      }
+   }
+   _chain->load ( );
+
+   for ( uint8_t i = 0; i < _chain->length ( ); i++ )
+   {
+      if ( ( _index == SRCHAIN_ALL ) || ( _index == i ) )
+      {
+         _chain->write ( i, _chain->read ( i ) & ~_En );     // Send with enable low
+      }
+   }
+   _chain->load ( );
+}
+
+//
+// pop
+uint8_t LiquidCrystal_SRChain::pop ( uint8_t &value, uint8_t &mode )
+{
+   if ( _queueHead == _queueCount )
+   {
+      // Empty, start over
+      _queueHead  = 0;
+      _queueCount = 0;
+      _queueRs    = 0;
+      return ( 0 );
+   }
+
+   value = _queue[_queueHead];
+   mode  = ( _queueRs & ( (uint16_t)1 << _queueHead ) ) ? LCD_DATA : COMMAND;
+   _queueHead++;
+   return ( 1 );
+}
@@ -0,0 +1,221 @@
+// ---------------------------------------------------------------------------
+// Copyright (C) - 2026
+//
+//    This program is free software: you can redistribute it and/or modify
+//    it under the terms of the GNU General Public License as published by
+//    the Free Software Foundation, either version 3 of the License, or
+//    any later version.
+//
+//    This program is distributed in the hope that it will be useful,
+//    but WITHOUT ANY WARRANTY; without even the implied warranty of
+//    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//    GNU General Public License for more details.
+//
+//    You should have received a copy of the GNU General Public License v3.0
+//    along with this program.
+//    If not, see <https://www.gnu.org/licenses/gpl-3.0.en.html>.
+//
+// ---------------------------------------------------------------------------
+//
+// Thread Safe: No
+// Extendable: Yes
+//
+// @file LiquidCrystal_SRChain.h
+// This file implements a liquid crystal library driving several LCDs from a
+// chain of cascaded latching shift registers, one register per LCD.
+//
+// @brief
+// All the registers share the data, clock and strobe lines (SRChainIO). Each
+// register is wired to its LCD as with LiquidCrystal_SR3W, by default:
+//
+//   +--------------------------------------------+
+//   |                 MCU                        |
+//   |   IO1           IO2           IO3          |
+//   +----+-------------+-------------+-----------+
+//        |             |             |
+//   +----+-------------+-------------+--+   +--------------+
+//   |  Strobe        Data          Clock|   | Strobe, Clock|
+//   |  74HC595 #0                  QH'  +---+ 74HC595 #1   +--- ...
+//   |  Qa0  Qb1  Qc2  Qd3  Qe4  Qf5  Qg6 |   |              |
+//   +--+----+----+----+----+----+----+--+   +--------------+
+//      DB4  DB5  DB6  DB7  E    Rw   RS         LCD #1
+//                  LCD #0
+//
+// A display created with the index SRCHAIN_ALL writes to every register of
+// the chain at once, it initializes, clears or fills all the panels with the
+// same content at the cost of a single display. All the panels must then be
+// wired the same way.
+//
+// Writes to the individual displays can be batched with
+// SRChainIO::beginBatch() and endBatch(), the displays are then updated in
+// parallel, one character per display and latch cycle.
+//
+// The functionality provided by this class and its base class is identical
+// to the original functionality of the Arduino LiquidCrystal library.
+//
+// @version API 1.0.0
+//
+// ---------------------------------------------------------------------------
+#ifndef _LIQUIDCRYSTAL_SRCHAIN_H_
+#define _LIQUIDCRYSTAL_SRCHAIN_H_
+
+#include <inttypes.h>
+#include "LCD.h"
+#include "SRChainIO.h"
+
+/*!
+ @defined
+ @abstract   Index of the display writing to the whole chain.
+ */
+#define SRCHAIN_ALL 0xFF
+
+/*!
+ @defined
+ @abstract   Bytes each display can queue while the chain is batching.
+ @discussion The chain is flushed when a queue fills up.
+ */
+#define SRCHAIN_QUEUE 16
+
+class LiquidCrystal_SRChain : public LCD
+{
+public:
+   /*!
+    @method
+    @abstract   Class constructor.
+    @discussion Attaches the display to a register of the chain with the
+    default pin mapping (see the file header). The constructor does not
+    initialize the LCD.
+    @param      chain[in] shift register chain, constructed before the display.
+    @param      index[in] register of the chain, SRCHAIN_ALL for all of them.
+    */
+   LiquidCrystal_SRChain ( SRChainIO &chain, uint8_t index );
+   // Constructor with backlight control
+   LiquidCrystal_SRChain ( SRChainIO &chain, uint8_t index,
+                           uint8_t backlighPin, t_backlightPol pol );
+
+   /*!
+    @method
+    @abstract   Class constructor.
+    @discussion Attaches the display to a register of the chain and defines
+    how the register is connected to the LCD.
+    @param      chain[in] shift register chain, constructed before the display.
+    @param      index[in] register of the chain, SRCHAIN_ALL for all of them.
+    @param      En[in] LCD En (Enable) pin connected to SR output pin.
+    @param      Rw[in] LCD Rw (Read/write) pin connected to SR output pin.
+    @param      Rs[in] LCD Rs (Reg Select) pin connected to SR output pin.
+    @param      d4[in] LCD data 4 pin map to the SR output pin.
+    @param      d5[in] LCD data 5 pin map to the SR output pin.
+    @param      d6[in] LCD data 6 pin map to the SR output pin.
+    @param      d7[in] LCD data 7 pin map to the SR output pin.
+    */
+   LiquidCrystal_SRChain ( SRChainIO &chain, uint8_t index,
+                           uint8_t En, uint8_t Rw, uint8_t Rs,
+                           uint8_t d4, uint8_t d5, uint8_t d6, uint8_t d7 );
+   // Constructor with backlight control
+   LiquidCrystal_SRChain ( SRChainIO &chain, uint8_t index,
+                           uint8_t En, uint8_t Rw, uint8_t Rs,
+                           uint8_t d4, uint8_t d5, uint8_t d6, uint8_t d7,
+                           uint8_t backlighPin, t_backlightPol pol );
+
+   /*!
+    @function
+    @abstract   LCD initialization.
+    @discussion Initializes the chain (once) and then the LCD. Use a
+    SRCHAIN_ALL display to initialize all the panels at the same time: the
+    displays of the individual panels take its settings and need no begin()
+    of their own.
+
+    @param      cols[in] the number of columns that the display has
+    @param      rows[in] the number of rows that the display has
+    @param      charsize[in] character size, default==LCD_5x8DOTS
+    */
+   virtual void begin(uint8_t cols, uint8_t rows, uint8_t charsize = LCD_5x8DOTS);
+
+   /*!
+    @function
+    @abstract   Send a particular value to the LCD.
+    @discussion Sends a particular value to the LCD for writing to the LCD or
+    as an LCD command. The value is queued while the chain is batching.
+
+    Users should never call this method.
+
+    @param      value[in] Value to send to the LCD.
+    @param      mode[in] DATA - write to the LCD CGRAM, COMMAND - write a
+    command to the LCD.
+    */
+   virtual void send(uint8_t value, uint8_t mode);
+
+   /*!
+    @function
+    @abstract   Sets the pin to control the backlight.
+    @discussion Sets the pin in the register to control the backlight. The
+    pin is shared by all the displays writing to the register, for a
+    SRCHAIN_ALL display by all the displays of the chain.
+
+    @param      value: pin mapped on the 74HC595N (0, .., 7) for (Qa0, .., Qh7)
+    respectively.
+    @param      pol: polarity POSITIVE|NEGATIVE.
+    */
+   void setBacklightPin ( uint8_t value, t_backlightPol pol );
+
+   /*!
+    @function
+    @abstract   Switch-on/off the LCD backlight.
+    @discussion Switch-on/off the LCD backlight, of all the panels for a
+    SRCHAIN_ALL display. The state is kept in the register image, so writes
+    through any display of the chain preserve it.
+
+    @param      value: backlight mode (HIGH|LOW)
+    */
+   void setBacklight ( uint8_t value );
+
+private:
+   friend class SRChainIO;
+
+   /*!
+    @method
+    @abstract   Initializes the LCD class
+    @discussion Initializes the pin mapping and attaches the display to its
+    register.
+    */
+   void init ( SRChainIO &chain, uint8_t index,
+               uint8_t En, uint8_t Rw, uint8_t Rs,
+               uint8_t d4, uint8_t d5, uint8_t d6, uint8_t d7 );
+
+   /*!
+    @method
+    @abstract   Register value for a nibble.
+    @discussion Maps the 4 least significant bits of value and RS to the
+    register outputs, E low. The backlight output keeps its state in the
+    register image, whichever display of the chain set it.
+    */
+   uint8_t map ( uint8_t value, uint8_t mode, uint8_t index );
+
+   /*!
+    @method
+    @abstract   Writes an 4 bit value to the LCD.
+    @discussion Latches the nibble with E high and then low.
+    */
+   void write4bits ( uint8_t value, uint8_t mode );
+
+   /*!
+    @method
+    @abstract   Next queued byte.
+    @result     0 if the queue is empty.
+    */
+   uint8_t pop ( uint8_t &value, uint8_t &mode );
+
+   SRChainIO *_chain;                   // chain the display is attached to
+   uint8_t    _index;                   // register of the display
+   uint8_t    _En;                      // register word for enable pin
+   uint8_t    _Rw;                      // register word for R/W pin
+   uint8_t    _Rs;                      // register word for Register Select pin
+   uint8_t    _nibbleMap[16];           // LCD data lines word of each nibble
+   uint8_t    _backlightPinMask;        // Backlight IO pin mask
+   uint8_t    _queue[SRCHAIN_QUEUE];    // bytes queued while batching
+   uint16_t   _queueRs;                 // data (1) or command (0) of each byte
+   uint8_t    _queueHead;               // next byte to send
+   uint8_t    _queueCount;              // bytes queued
+};
+
+#endif
@@ -0,0 +1,234 @@
+// ---------------------------------------------------------------------------
+// Copyright (C) - 2026
+//
+//    This program is free software: you can redistribute it and/or modify
+//    it under the terms of the GNU General Public License as published by
+//    the Free Software Foundation, either version 3 of the License, or
+//    any later version.
+//
+//    This program is distributed in the hope that it will be useful,
+//    but WITHOUT ANY WARRANTY; without even the implied warranty of
+//    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//    GNU General Public License for more details.
+//
+//    You should have received a copy of the GNU General Public License v3.0
+//    along with this program.
+//    If not, see <https://www.gnu.org/licenses/gpl-3.0.en.html>.
+//
+// ---------------------------------------------------------------------------
+//
+// Thread Safe: No
+// Extendable: Yes
+//
+// @file SRChainIO.cpp
+// This file implements a chain of cascaded latching shift registers sharing
+// the data, clock and strobe lines.
+//
+// @brief
+// Keeps an image of every register in the chain and loads the whole chain
+// with a single shift sequence and strobe.
+//
+// @version API 1.0.0
+//
+// ---------------------------------------------------------------------------
+#if (ARDUINO <  100)
+#include <WProgram.h>
+#else
+#include <Arduino.h>
+#endif
+
+#include <inttypes.h>
+#include "SRChainIO.h"
+#include "LiquidCrystal_SRChain.h"
+#ifdef FIO_HW_SPI
+#include <SPI.h>
+#endif
+
+// CONSTRUCTOR
+// ---------------------------------------------------------------------------
+SRChainIO::SRChainIO ( uint8_t data, uint8_t clk, uint8_t strobe, uint8_t length )
+{
+   // Data and clock are driven by the SPI peripheral when HW_SPI is used,
+   // it is initialised in begin().
+   _spi   = ( data == HW_SPI );
+   _ready = 0;
+   _batch = 0;
+   if ( !_spi )
+   {
+      _data     = fio_pinToBit(data);
+      _clk      = fio_pinToBit(clk);
+      _data_reg = fio_pinToOutputRegister(data);
+      _clk_reg  = fio_pinToOutputRegister(clk);
+   }
+   _strobe     = fio_pinToBit(strobe);
+   _strobe_reg = fio_pinToOutputRegister(strobe);
+
+   _length = ( length > SRCHAIN_MAX ) ? SRCHAIN_MAX : length;
+   if ( _length == 0 )
+   {
+      _length = 1;
+   }
+
+   for ( uint8_t i = 0; i < SRCHAIN_MAX; i++ )
+   {
+      _image[i]     = 0;
+      _backlight[i] = 0;
+      _client[i]    = NULL;
+   }
+}
+
+// PUBLIC METHODS
+// ---------------------------------------------------------------------------
+
+//
+// begin
+void SRChainIO::begin ( )
+{
+   if ( _ready )
+   {
+      return;
+   }
+
+   if ( _spi )
+   {
+#ifdef FIO_HW_SPI
+      SPI.begin();
+#ifndef SPI_HAS_TRANSACTION
+      SPI.setBitOrder(MSBFIRST);
+      SPI.setDataMode(SPI_MODE0);
+      SPI.setClockDivider(SPI_CLOCK_DIV2);
+#endif
+#endif
+   }
+   _ready = 1;
+   load ( );
+}
+
+//
+// write
+void SRChainIO::write ( uint8_t index, uint8_t value )
+{
+   if ( index < _length )
+   {
+      _image[index] = value;
+   }
+}
+
+//
+// read
+uint8_t SRChainIO::read ( uint8_t index )
+{
+   return ( ( index < _length ) ? _image[index] : 0 );
+}
+
+//
+// load
+void SRChainIO::load ( )
+{
+   uint8_t i = _length;
+
+   if ( _spi )
+   {
+      // Nothing can be sent until begin() has started the SPI peripheral
+      if ( !_ready )
+      {
+         return;
+      }
+#ifdef FIO_HW_SPI
+#ifdef SPI_HAS_TRANSACTION
+      SPI.beginTransaction ( SPISettings ( SR_SPI_CLOCK, MSBFIRST, SPI_MODE0 ) );
+#endif
+      while ( i-- )
+      {
+         SPI.transfer ( _image[i] );
+      }
+#ifdef SPI_HAS_TRANSACTION
+      SPI.endTransaction ( );
+#endif
+#endif
+   }
+   else
+   {
+      // The last register of the chain goes out first
+      while ( i-- )
+      {
+         fio_shiftOut(_data_reg, _data, _clk_reg, _clk, _image[i], MSBFIRST);
+      }
+   }
+
+   // Strobe the data into the latches
+   FIO_OP_BLOCK
+   {
+      fio_digitalWrite_HIGH(_strobe_reg, _strobe);
+      fio_digitalWrite_SWITCHTO(_strobe_reg, _strobe, LOW);
+   }
+}
+
+//
+// beginBatch
+void SRChainIO::beginBatch ( )
+{
+   _batch = 1;
+}
+
+//
+// endBatch
+void SRChainIO::endBatch ( )
+{
+   flush ( );
+   _batch = 0;
+}
+
+//
+// flush
+void SRChainIO::flush ( )
+{
+   uint8_t value[SRCHAIN_MAX];
+   uint8_t mode[SRCHAIN_MAX];
+   uint8_t active;
+   uint8_t i;
+
+   do
+   {
+      // Next queued byte of every display
+      // --------------------------------
+      active = 0;
+      for ( i = 0; i < _length; i++ )
+      {
+         if ( ( _client[i] != NULL ) && _client[i]->pop ( value[i], mode[i] ) )
+         {
+            active |= ( 1 << i );
+         }
+      }
+
+      if ( active )
+      {
+         // Upper and lower nibbles, each latched with E high and then low
+         // on all the active displays at once.
+         // --------------------------------
+         for ( uint8_t nibble = 0; nibble < 2; nibble++ )
+         {
+            uint8_t shift = ( nibble == 0 ) ? 4 : 0;
+            
+            for ( i = 0; i < _length; i++ )
+            {
+               if ( active & ( 1 << i ) )
+               {
+                  _image[i] = _client[i]->map ( value[i] >> shift, mode[i], i ) |
+                              _client[i]->_En;
+               }
+            }
+            load ( );
+            for ( i = 0; i < _length; i++ )
+            {
+               if ( active & ( 1 << i ) )
+               {
+                  _image[i] &= ~_client[i]->_En;
+               }
+            }
+            load ( );
+         }
+         delayMicroseconds ( 37 );      // commands & data writes need > 37us to complete
+      }
+   } while ( active );
+}
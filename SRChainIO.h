@@ -0,0 +1,152 @@
+// ---------------------------------------------------------------------------
+// Copyright (C) - 2026
+//
+//    This program is free software: you can redistribute it and/or modify
+//    it under the terms of the GNU General Public License as published by
+//    the Free Software Foundation, either version 3 of the License, or
+//    any later version.
+//
+//    This program is distributed in the hope that it will be useful,
+//    but WITHOUT ANY WARRANTY; without even the implied warranty of
+//    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//    GNU General Public License for more details.
+//
+//    You should have received a copy of the GNU General Public License v3.0
+//    along with this program.
+//    If not, see <https://www.gnu.org/licenses/gpl-3.0.en.html>.
+//
+// ---------------------------------------------------------------------------
+//
+// Thread Safe: No
+// Extendable: Yes
+//
+// @file SRChainIO.h
+// This file implements a chain of cascaded latching shift registers sharing
+// the data, clock and strobe lines.
+//
+// @brief
+// Keeps an image of every register in the chain and loads the whole chain
+// with a single shift sequence and strobe. Register 0 is the one connected to
+// the MCU, register 1 the one fed by its QH' output and so on.
+//
+// Each register drives an LCD through LiquidCrystal_SRChain. The chain also
+// batches the writes of those displays: between beginBatch() and endBatch()
+// the characters written to each display are queued and then sent to all the
+// displays at the same time, one character per display and latch cycle.
+//
+// The chain can be loaded through the SPI peripheral by passing HW_SPI as the
+// data and clock pins, as with LiquidCrystal_SR3W.
+//
+// @version API 1.0.0
+//
+// ---------------------------------------------------------------------------
+#ifndef _SRCHAINIO_H_
+#define _SRCHAINIO_H_
+
+#include <inttypes.h>
+#include "FastIO.h"
+
+/*!
+ @defined
+ @abstract   Maximum number of registers in a chain.
+ */
+#define SRCHAIN_MAX 8
+
+class LiquidCrystal_SRChain;
+
+class SRChainIO
+{
+public:
+   /*!
+    @method
+    @abstract   Constructor method
+    @discussion Class constructor, defines the IO driving the chain. The
+    registers are not loaded until begin() is called.
+    @param      data[in] digital IO connected to the data pin, HW_SPI for MOSI.
+    @param      clk[in] digital IO connected to the clock pin, HW_SPI for SCK.
+    @param      strobe[in] digital IO connected to the strobe pin.
+    @param      length[in] number of registers in the chain (1..SRCHAIN_MAX).
+    */
+   SRChainIO ( uint8_t data, uint8_t clk, uint8_t strobe, uint8_t length );
+
+   /*!
+    @method
+    @abstract   Initializes the chain.
+    @discussion Starts the SPI peripheral if used and loads the register
+    images. Further calls do nothing.
+    */
+   void begin ( );
+
+   /*!
+    @method
+    @abstract   Number of registers in the chain.
+    */
+   uint8_t length ( ) { return _length; }
+
+   /*!
+    @method
+    @abstract   Sets the image of a register.
+    @discussion The register outputs change on the next load().
+    @param      index[in] register in the chain.
+    @param      value[in] value of its outputs.
+    */
+   void write ( uint8_t index, uint8_t value );
+
+   /*!
+    @method
+    @abstract   Image of a register.
+    @param      index[in] register in the chain.
+    @result     value last written to the register.
+    */
+   uint8_t read ( uint8_t index );
+
+   /*!
+    @method
+    @abstract   Loads the whole chain.
+    @discussion Shifts out the image of every register, the last one first,
+    and strobes them into the output latches at the same time.
+    */
+   void load ( );
+
+   /*!
+    @method
+    @abstract   Starts batching the display writes.
+    @discussion Characters and commands written to the displays of the chain
+    are queued until endBatch() or flush(). Clear and home are not queued,
+    they flush the queues first.
+    */
+   void beginBatch ( );
+
+   /*!
+    @method
+    @abstract   Sends the queued writes and stops batching.
+    */
+   void endBatch ( );
+
+   /*!
+    @method
+    @abstract   Sends the queued writes of all the displays.
+    @discussion Each latch cycle carries the next queued byte of every display
+    with pending writes, so N displays take the time of the longest queue.
+    */
+   void flush ( );
+
+private:
+   friend class LiquidCrystal_SRChain;
+
+   fio_register _data_reg;             // data pin MCU register
+   fio_bit      _data;                 // data pin
+   fio_register _clk_reg;              // clock pin MCU register
+   fio_bit      _clk;                  // clock pin
+   fio_register _strobe_reg;           // strobe pin MCU register
+   fio_bit      _strobe;               // strobe pin
+   uint8_t      _length;               // registers in the chain
+   uint8_t      _spi;                  // chain loaded through SPI
+   uint8_t      _ready;                // begin() called
+   uint8_t      _batch;                // display writes are queued
+   uint8_t      _image[SRCHAIN_MAX];   // register images
+   uint8_t      _backlight[SRCHAIN_MAX]; // backlight pin mask of each register
+   LiquidCrystal_SRChain *_client[SRCHAIN_MAX]; // display of each register
+};
+
+#endif
@@ -0,0 +1,37 @@
+#include <SRChainIO.h>
+#include <LiquidCrystal_SRChain.h>
+
+// Three 74HC595 in a chain, one LCD on each
+SRChainIO chain(2, 3, 4, 3);
+//              |  |  |  |
+//              |  |  |  \-- Registers in the chain
+//              |  |  \----- Strobe Pin
+//              |  \-------- Clock Pin
+//              \----------- Data Pin
+
+LiquidCrystal_SRChain all(chain, SRCHAIN_ALL); // every panel at once
+LiquidCrystal_SRChain lcd0(chain, 0);
+LiquidCrystal_SRChain lcd1(chain, 1);
+LiquidCrystal_SRChain lcd2(chain, 2);
+
+void setup()
+{
+  all.begin(16, 2);             // initialize all the panels at once,
+                                // lcd0..2 take its settings
+  
+  all.print("Station");         // same text on every panel
+}
+
+void loop()
+{
+  unsigned long t = millis() / 1000;
+  
+  // Update the three panels in parallel
+  chain.beginBatch();
+  lcd0.setCursor(0, 1); lcd0.print("A: "); lcd0.print(t);
+  lcd1.setCursor(0, 1); lcd1.print("B: "); lcd1.print(t * 2);
+  lcd2.setCursor(0, 1); lcd2.print("C: "); lcd2.print(t * 3);
+  chain.endBatch();
+  
+  delay(250);
+}